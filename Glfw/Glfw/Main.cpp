@@ -14,13 +14,23 @@
 #pragma comment(lib, "glfw3dll.lib")
 #endif
 
-//#define USE_BORDERLESS	//!< {[_[X
-//#define USE_EXTFULLSCREEN //!< gj^AtXN[
+//#define USE_BORDERLESS	//!< ボーダーレス
+//#define USE_EXTFULLSCREEN //!< 拡張モニタ、フルスクリーン
 
 #define USE_INDEX
 #define USE_SECONDARY_CB
 
-//!< R[obN (Callbacks)
+//!< meson ビルドでは SPIR-V がヘッダとして生成されバイナリに埋め込まれる、ファイルが存在すればそちらで差し替える
+//!< (In meson build, SPIR-V is generated as header and embedded in binary, overridden by file if exists)
+#if __has_include("Glfw.vert.spv.h")
+#include "Glfw.vert.spv.h"
+#include "Glfw.frag.spv.h"
+#define EMBEDDED_SPIRV(X) std::span<const uint32_t>(X)
+#else
+#define EMBEDDED_SPIRV(X) std::span<const uint32_t>()
+#endif
+
+//!< コールバック (Callbacks)
 static void GlfwErrorCallback(int Code, const char* Description)
 {
 	std::cerr << "[Glfw] ErrorCallback Code = " << Code << ", Description = " << Description << std::endl;
@@ -42,9 +52,9 @@ class Glfw
 public:
 	Glfw(GLFWwindow* Win) : GlfwWindow(Win) {
 		uint32_t Count = 0;
-		//!< glfwGetRequiredInstanceExtensions vbgtH[̈ႢzĂ
+		//!< glfwGetRequiredInstanceExtensions がプラットフォーム毎の違いを吸収してくれる
 		const auto Ptr = glfwGetRequiredInstanceExtensions(&Count);
-		//!< u|C^ + v span Ŏ󂯂
+		//!< 「ポインタ + 個数」を span で受ける
 		const auto Span = std::span(Ptr, Count);
 		InstanceExtensions.assign(std::begin(Span), std::end(Span));
 		for (auto& i : InstanceExtensions) {
@@ -92,10 +102,46 @@ public:
 			.pInheritanceInfo = nullptr
 		};
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
+			constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }) };
+#ifdef USE_DYNAMIC_RENDERING
+			//!< レンダーパスの代わりにフレームグラフでレイアウト遷移する (Layout transitions are done by frame graph instead of render pass)
+			FrameGraph FG;
+			const auto Backbuffer = FG.ImportImage("Swapchain", Swapchain.ImageAndViews[i].first,
+				FrameGraph::Usage({ .Stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .Access = VK_ACCESS_2_NONE, .Layout = VK_IMAGE_LAYOUT_UNDEFINED }),
+				VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+			FG.AddPass("Clear", [&](const VkCommandBuffer CB) {
+				const std::array RAIs = {
+					VkRenderingAttachmentInfo({
+						.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+						.pNext = nullptr,
+						.imageView = Swapchain.ImageAndViews[i].second, .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+						.resolveMode = VK_RESOLVE_MODE_NONE, .resolveImageView = VK_NULL_HANDLE, .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+						.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR, .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+						.clearValue = CVs[0]
+					}),
+				};
+				const VkRenderingInfo RI = {
+					.sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+					.pNext = nullptr,
+					.flags = 0,
+					.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = Swapchain.Extent }),
+					.layerCount = 1,
+					.viewMask = 0,
+					.colorAttachmentCount = static_cast<uint32_t>(std::size(RAIs)), .pColorAttachments = std::data(RAIs),
+					.pDepthAttachment = nullptr,
+					.pStencilAttachment = nullptr
+				};
+				vkCmdBeginRendering(CB, &RI); {
+					vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
+					vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
+				} vkCmdEndRendering(CB);
+			}).Write(Backbuffer, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+			FG.Compile();
+			FG.Execute(CB);
+#else
 			const auto RP = RenderPasses[0];
 			const auto FB = Framebuffers[i];
 
-			constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }) };
 			const VkRenderPassBeginInfo RPBI = {
 				.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 				.pNext = nullptr,
@@ -108,6 +154,7 @@ public:
 				vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
 				vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
 			} vkCmdEndRenderPass(CB);
+#endif
 		} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 		LOG();
 	}
@@ -155,15 +202,15 @@ public:
 #endif
 		LOG();
 	}
-	virtual void CreatePipeline() override {
-		Pipelines.emplace_back();
+	virtual void CreatePipeline(std::vector<VkPipeline>& PLs) override {
+		PLs.emplace_back();
 		
 		const std::array SMs = {
-			CreateShaderModule(std::filesystem::path(".") / "Glfw.vert.spv"),
-			CreateShaderModule(std::filesystem::path(".") / "Glfw.frag.spv"),
+			CreateShaderModule(std::filesystem::path(".") / "Glfw.vert.spv", EMBEDDED_SPIRV(Glfw_vert)),
+			CreateShaderModule(std::filesystem::path(".") / "Glfw.frag.spv", EMBEDDED_SPIRV(Glfw_frag)),
 		};
 
-		std::vector<std::thread> Threads = {};
+		std::vector<JobSystem::JobHandle> Jobs = {};
 
 		const std::vector VIBDs = {
 			VkVertexInputBindingDescription({.binding = 0, .stride = sizeof(glm::vec3) + sizeof(glm::vec3), .inputRate = VK_VERTEX_INPUT_RATE_VERTEX }),
@@ -172,16 +219,35 @@ public:
 			VkVertexInputAttributeDescription({.location = 0, .binding = 0, .format = VK_FORMAT_R32G32B32_SFLOAT, .offset = 0 }),
 			VkVertexInputAttributeDescription({.location = 1, .binding = 0, .format = VK_FORMAT_R32G32B32_SFLOAT, .offset = sizeof(glm::vec3) }),
 		};
-		Threads.emplace_back(std::thread([&] {
-			VK::CreatePipeline(Pipelines[0],
+#ifdef USE_DYNAMIC_RENDERING
+		//!< レンダーパスの代わりにアタッチメントのフォーマットを指定する (Specify attachment formats instead of render pass)
+		const std::array CAFs = { SelectedSurfaceFormat.format };
+		const VkPipelineRenderingCreateInfo PRCI = {
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+			.pNext = nullptr,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs)), .pColorAttachmentFormats = std::data(CAFs),
+			.depthAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED
+		};
+		const VkRenderPass RP = VK_NULL_HANDLE;
+		const auto pPRCI = &PRCI;
+#else
+		const auto RP = RenderPasses[0];
+		const VkPipelineRenderingCreateInfo* pPRCI = nullptr;
+#endif
+		Jobs.emplace_back(JobSystem::Get().Schedule([&] {
+			VK::CreatePipeline(PLs[0],
 			SMs[0], SMs[1],
 			VIBDs, VIADs,
 			VK_FALSE,
 			PipelineLayouts[0], 
-			RenderPasses[0]);
+			RP,
+			{},
+			pPRCI);
 		}));
 		
-		for (auto& i : Threads) { i.join(); }
+		JobSystem::Get().Wait(Jobs);
 
 		for (const auto i : SMs) {
 			vkDestroyShaderModule(Device, i, nullptr);
@@ -190,12 +256,30 @@ public:
 	}
 #ifdef USE_SECONDARY_CB
 	virtual void PopulateSecondaryCommandBuffer(const int i) override {
-		const auto RP = RenderPasses[0];
 		const auto CB = SecondaryCommandBuffers[0].second[i];
 
+#ifdef USE_DYNAMIC_RENDERING
+		//!< レンダーパスの代わりにアタッチメントのフォーマットを継承する (Inherit attachment formats instead of render pass)
+		const std::array CAFs = { SelectedSurfaceFormat.format };
+		const VkCommandBufferInheritanceRenderingInfo CBIRI = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+			.pNext = nullptr,
+			.flags = 0,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs)), .pColorAttachmentFormats = std::data(CAFs),
+			.depthAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT
+		};
+		const VkRenderPass RP = VK_NULL_HANDLE;
+		const void* pNext = &CBIRI;
+#else
+		const auto RP = RenderPasses[0];
+		const void* pNext = nullptr;
+#endif
 		const VkCommandBufferInheritanceInfo CBII = {
 			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
-			.pNext = nullptr,
+			.pNext = pNext,
 			.renderPass = RP,
 			.subpass = 0,
 			.framebuffer = VK_NULL_HANDLE,
@@ -209,29 +293,45 @@ public:
 			.pInheritanceInfo = &CBII
 		};
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
-			const auto PL = Pipelines[0];
+			PopulateDraw(CB);
+		}VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
+	}
+#endif
+	//!< レンダーパス (ダイナミックレンダリング) 内の描画コマンド (Draw commands in render pass (dynamic rendering))
+	void PopulateDraw(const VkCommandBuffer CB) {
+		const auto PL = Pipelines[0];
 
-			const auto VB = VertexBuffers[0].first;
-			const auto IDB = IndirectBuffers[0].first;
+		const auto VB = VertexBuffers[0].first;
+		const auto IDB = IndirectBuffers[0].first;
 
-			vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PL);
+		vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PL);
 
-			vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
-			vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
+		vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
+		vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+		SetDynamicState(CB, {});
+#endif
 
-			const std::array VBs = { VB };
-			const std::array Offsets = { VkDeviceSize(0) };
-			vkCmdBindVertexBuffers(CB, 0, static_cast<uint32_t>(std::size(VBs)), std::data(VBs), std::data(Offsets));
+		const std::array VBs = { VB };
+		const std::array Offsets = { VkDeviceSize(0) };
+		vkCmdBindVertexBuffers(CB, 0, static_cast<uint32_t>(std::size(VBs)), std::data(VBs), std::data(Offsets));
 #ifdef USE_INDEX
-			const auto IB = IndexBuffers[0].first;
-			vkCmdBindIndexBuffer(CB, IB, 0, VK_INDEX_TYPE_UINT32);
-			vkCmdDrawIndexedIndirect(CB, IDB, 0, 1, 0);
+		const auto IB = IndexBuffers[0].first;
+		vkCmdBindIndexBuffer(CB, IB, 0, VK_INDEX_TYPE_UINT32);
+		vkCmdDrawIndexedIndirect(CB, IDB, 0, 1, 0);
 #else
-			vkCmdDrawIndirect(CB, IDB, 0, 1, 0);
+		vkCmdDrawIndirect(CB, IDB, 0, 1, 0);
 #endif
-		}VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 	}
+	void PopulateRenderPassContents(const VkCommandBuffer CB, [[maybe_unused]] const int i) {
+#ifdef USE_SECONDARY_CB
+		const auto SCB = SecondaryCommandBuffers[0].second[i];
+		const std::array SCBs = { SCB };
+		vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
+#else
+		PopulateDraw(CB);
 #endif
+	}
 	virtual void PopulatePrimaryCommandBuffer(const int i) override {
 		const auto CB = PrimaryCommandBuffers[0].second[i];
 
@@ -242,10 +342,50 @@ public:
 			.pInheritanceInfo = nullptr
 		};
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
+			constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }) };
+#ifdef USE_SECONDARY_CB
+			constexpr auto SC = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+#else
+			constexpr auto SC = VK_SUBPASS_CONTENTS_INLINE;
+#endif
+#ifdef USE_DYNAMIC_RENDERING
+			//!< レンダーパスの代わりにフレームグラフでレイアウト遷移する (Layout transitions are done by frame graph instead of render pass)
+			FrameGraph FG;
+			const auto Backbuffer = FG.ImportImage("Swapchain", Swapchain.ImageAndViews[i].first,
+				FrameGraph::Usage({ .Stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .Access = VK_ACCESS_2_NONE, .Layout = VK_IMAGE_LAYOUT_UNDEFINED }),
+				VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+			FG.AddPass("Triangle", [&](const VkCommandBuffer CB) {
+				const std::array RAIs = {
+					VkRenderingAttachmentInfo({
+						.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+						.pNext = nullptr,
+						.imageView = Swapchain.ImageAndViews[i].second, .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+						.resolveMode = VK_RESOLVE_MODE_NONE, .resolveImageView = VK_NULL_HANDLE, .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+						.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR, .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+						.clearValue = CVs[0]
+					}),
+				};
+				const VkRenderingInfo RI = {
+					.sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+					.pNext = nullptr,
+					.flags = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS == SC ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0,
+					.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = Swapchain.Extent }),
+					.layerCount = 1,
+					.viewMask = 0,
+					.colorAttachmentCount = static_cast<uint32_t>(std::size(RAIs)), .pColorAttachments = std::data(RAIs),
+					.pDepthAttachment = nullptr,
+					.pStencilAttachment = nullptr
+				};
+				vkCmdBeginRendering(CB, &RI); {
+					PopulateRenderPassContents(CB, i);
+				} vkCmdEndRendering(CB);
+			}).Write(Backbuffer, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+			FG.Compile();
+			FG.Execute(CB);
+#else
 			const auto RP = RenderPasses[0];
 			const auto FB = Framebuffers[i];
 
-			constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }) };
 			const VkRenderPassBeginInfo RPBI = {
 				.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 				.pNext = nullptr,
@@ -254,34 +394,8 @@ public:
 				.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = Swapchain.Extent }),
 				.clearValueCount = static_cast<uint32_t>(size(CVs)), .pClearValues = data(CVs)
 			};
-#ifdef USE_SECONDARY_CB
-			vkCmdBeginRenderPass(CB, &RPBI, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS); {
-				const auto SCB = SecondaryCommandBuffers[0].second[i];
-				const std::array SCBs = { SCB };
-				vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
-			} vkCmdEndRenderPass(CB);
-#else
-			vkCmdBeginRenderPass(CB, &RPBI, VK_SUBPASS_CONTENTS_INLINE); {
-				const auto PL = Pipelines[0];
-
-				vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PL);
-
-				vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
-				vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
-
-				const auto VB = VertexBuffers[0].first;
-				const auto IDB = IndirectBuffers[0].first;
-
-				const std::array VBs = { VB };
-				const std::array Offsets = { VkDeviceSize(0) };
-				vkCmdBindVertexBuffers(CB, 0, static_cast<uint32_t>(std::size(VBs)), std::data(VBs), std::data(Offsets));
-#ifdef USE_INDEX
-				const auto IB = IndexBuffers[0].first;
-				vkCmdBindIndexBuffer(CB, IB, 0, VK_INDEX_TYPE_UINT32);
-				vkCmdDrawIndexedIndirect(CB, IDB, 0, 1, 0);
-#else
-				vkCmdDrawIndirect(CB, IDB, 0, 1, 0);
-#endif
+			vkCmdBeginRenderPass(CB, &RPBI, SC); {
+				PopulateRenderPassContents(CB, i);
 			} vkCmdEndRenderPass(CB);
 #endif
 		} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
@@ -294,32 +408,32 @@ int main()
 	glfwGetVersion(&Major, &Minor, &Rev);
 	std::cout << "GLFW : " << Major << ", " << Minor << ", " << Rev << std::endl;
 
-	// 3.4 ȏ
+	// 3.4 以上
 #ifdef GLFW_PLATFORM
 	glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_WAYLAND);
 	glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_WIN32);
 #endif
 
-	//!<  (Initialize)
+	//!< 初期化 (Initialize)
 	if (!glfwInit()) {
 		std::cerr << "glfwInit() failed" << std::endl;
 		exit(EXIT_FAILURE);
 	}
 
-	// 3.4 ȏ
+	// 3.4 以上
 #ifdef GLFW_PLATFORM
 	const auto Platform = glfwGetPlatform();
 	std::cout << Platform << std::endl;
 #endif
 
-	//!< Vulkan T|[g̗L (Vulkan supported)
+	//!< Vulkan サポートの有無 (Vulkan supported)
 	if (GLFW_FALSE == glfwVulkanSupported()) {
 		std::cerr << "Vulkan not supported" << std::endl;
 		glfwTerminate();
 		exit(EXIT_FAILURE);
 	}
 
-	//!< j^[ƃrfI[h (Enumerate monitors and video modes)
+	//!< モニターとビデオモードを列挙 (Enumerate monitors and video modes)
 	int MCount;
 	const auto MPtr = glfwGetMonitors(&MCount);
 	const auto Monitors = std::span(MPtr, MCount);
@@ -334,41 +448,41 @@ int main()
 		}
 	}
 
-	//!< OpenGL ReLXg쐬Ȃ (Not create OpenGL context)
+	//!< OpenGL コンテキストを作成しない (Not create OpenGL context)
 	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 #ifdef USE_BORDERLESS
-	//!< {[_[Xɂꍇ (Borderless)
+	//!< ボーダーレスにする場合 (Borderless)
 	glfwWindowHint(GLFW_DECORATED, GLFW_FALSE);
 #endif
 
 	auto Width = 800, Height = 600;
-	//!< j^I
+	//!< モニタを選択
 	GLFWmonitor* Mon = nullptr;
 	if (!std::empty(Monitors)) {
 #ifdef USE_EXTFULLSCREEN
-		//!< gj^ (Ō̗vf) I (Select ext monitor)
+		//!< 拡張モニタ (最後の要素) を選択 (Select ext monitor)
 		Mon = Monitors.back();
 #else
-		//!< vC}j^ (ftHg) I (Select primary monitor (default))
+		//!< プライマリモニタ (デフォルト) を選択 (Select primary monitor (default))
 		Mon = *std::ranges::find_if(Monitors, [&](const auto& i) { return i == glfwGetPrimaryMonitor(); });
 #endif
-		//!< rfI[hI
+		//!< ビデオモードを選択
 		int VCount;
 		auto VPtr = glfwGetVideoModes(Mon, &VCount);
 		const auto Vids = std::span(VPtr, VCount);
 		if (!std::empty(Vids)) {
-			//!< 𑜓x̍rfI[h͍Ōɗ񋓂悤Ȃ̂ŁAŌ̗vfI (Most high resolution vide mode will be in last element)
+			//!< 解像度の高いビデオモードは最後に列挙されるようなので、最後の要素を選択 (Most high resolution vide mode will be in last element)
 			const auto Vid = Vids.back();
 			Width = Vid.width;
 			Height = Vid.height;
 		}
 	}
 
-	//!< EChE쐬 (Create window)
-	//!< IɃj^w肵ꍇtXN[ɂȂ (Explicitly select monitor to be fullscreen)
-	//!< tXN[ɂȂꍇ nullptr w肷邱 (Select nullptr to be windowed)
+	//!< ウインドウ作成 (Create window)
+	//!< 明示的にモニタを指定した場合フルスクリーンになる (Explicitly select monitor to be fullscreen)
+	//!< フルスクリーンにしない場合は nullptr を指定すること (Select nullptr to be windowed)
 	const auto GlfwWin = glfwCreateWindow(Width, Height, "Title", Mon, nullptr);
-	//!< R[obNo^ (Register callbacks) EChE쐬ɂĂ
+	//!< コールバック登録 (Register callbacks) ウインドウ作成直後にやっておく
 	glfwSetErrorCallback(GlfwErrorCallback);
 	glfwSetKeyCallback(GlfwWin, GlfwKeyCallback);
 	glfwSetWindowSizeCallback(GlfwWin, GlfwWindowSizeCallback);
@@ -395,14 +509,17 @@ int main()
 
 	Vk.PopulateCommandBuffer();
 
-	//!< [v (Loop)
+	//!< ループ (Loop)
 	while (!glfwWindowShouldClose(GlfwWin)) {
 		glfwPollEvents();
 
 		Vk.Render();
 	}
 
-	//!< GLFW Еt (Terminate)
+	//!< exit() ではデストラクタが呼ばれないので、ここで後片付けする (Destructor is not called with exit(), so shut down here)
+	Vk.Shutdown();
+
+	//!< GLFW 後片付け (Terminate)
 	glfwDestroyWindow(GlfwWin);
 	glfwTerminate();
 
@@ -2,10 +2,49 @@
 
 //#define DISPLAY_QUILT
 #ifdef DISPLAY_QUILT
-//!< LgOŃ_OĂꍇAōÊ݂\ [Display most left, right quilt, only in case self rendering quilt]
+//!< キルトを自前でレンダリングしている場合、最左右のみを表示する [Display most left, right quilt, only in case self rendering quilt]
 #define DISPLAY_MOST_LR_QUILT
 #endif
 
+//!< バインドレス (デスクリプタインデクシング)、デバイスがサポートしない場合は従来通り [Bindless (descriptor indexing), falls back if device does not support]
+//#define USE_BINDLESS
+//!< プッシュデスクリプタ、デバイスがサポートしない場合は従来通り [Push descriptor, falls back if device does not support]
+//#define USE_PUSH_DESCRIPTOR
+//!< 起動時は安価なパイプライン (テッセレーション、ジオメトリシェーダ無し、レンチキュラー無し) で表示を開始し、本来のパイプラインはバックグラウンドで作成して差し替える
+//!< [Start with cheap pipelines (no tessellation, geometry shader, lenticular), full pipelines are created in background and swapped]
+//#define USE_PIPELINE_FALLBACK
+//!< ディスプレースメントマップはワーカースレッドで読み込み、それまではプレースホルダで表示する
+//!< [Displacement maps are loaded on worker threads, placeholders are displayed until then]
+//#define USE_ASYNC_TEXTURE
+//!< カラーマップのミップチェインを GPU で作成する (キルトの各ビューでは大きく縮小されるため) [Generate mip chain of color map on GPU (heavily minified in each quilt view)]
+//#define USE_MIPMAP
+
+//!< meson ビルドでは SPIR-V がヘッダとして生成されバイナリに埋め込まれる、USE_SHADER_HOT_RELOAD 定義時はファイルが存在すればそちらで差し替える
+//!< [In meson build, SPIR-V is generated as header and embedded in binary, overridden by file if exists when USE_SHADER_HOT_RELOAD is defined]
+#if __has_include("Views.vert.spv.h")
+#include "Quilt.vert.spv.h"
+#include "Quilt.frag.spv.h"
+#include "QuiltRaw.frag.spv.h"
+#include "Views.vert.spv.h"
+#include "ViewsFallback.vert.spv.h"
+#include "Views.frag.spv.h"
+#include "Views.tese.spv.h"
+#include "Views.tesc.spv.h"
+#include "Views.geom.spv.h"
+#include "ViewsBindless.frag.spv.h"
+#include "ViewsBindless.tese.spv.h"
+#include "ViewsVirtual.frag.spv.h"
+#include "ViewsVirtual.tese.spv.h"
+#include "Convert.comp.spv.h"
+#include "Pattern.comp.spv.h"
+#define EMBEDDED_SPIRV(X) std::span<const uint32_t>(X)
+#else
+#define EMBEDDED_SPIRV(X) std::span<const uint32_t>()
+#endif
+
+#include "VirtualTexture.h"
+#include "SPSCRing.h"
+
 #define TO_RADIAN(x) ((x) * std::numbers::pi_v<float> / 180.0f)
 #define CHECKDIMENSION(_TileXY) if (_TileXY > TileDimensionMax) { BREAKPOINT(); }
 
@@ -49,9 +88,9 @@ public:
 
 	float GetOffsetAngle(const int i) const { return static_cast<float>(i) * OffsetAngleCoef - HalfViewCone; }
 	void CreateProjectionMatrix(const int i) {
-		//!< EɂĂpx (WA)
+		//!< 左右方向にずれている角度 (ラジアン)
 		const auto OffsetAngle = GetOffsetAngle(i);
-		//!< EɂĂ鋗
+		//!< 左右方向にずれている距離
 		const auto OffsetX = CameraDistance * std::tan(OffsetAngle);
 
 		const auto DisplayAspect = GetDisplayAspect();
@@ -120,7 +159,10 @@ protected:
 
 protected:
 	int QuiltX = 3360, QuiltY = 3360;
-	float HalfViewCone = 40.0f; //!< ̎_ł͑f̊pxw [For now save as degree]
+	//!< キルト (レンダーターゲット) のフォーマット (Quilt (render target) formats)
+	static constexpr VkFormat QuiltColorFormat = VK_FORMAT_B8G8R8A8_UNORM;
+	static constexpr VkFormat QuiltDepthFormat = VK_FORMAT_D24_UNORM_S8_UINT;
+	float HalfViewCone = 40.0f; //!< この時点では素の角度を指定 [For now save as degree]
 	long WinX = 0, WinY = 0;
 	unsigned long WinWidth = 1536, WinHeight = 2048;
 
@@ -150,120 +192,268 @@ public:
 	DisplacementVK() : Super() {
 		SetParam(HardWareEnum::Go);
 	}
+	//!< バックグラウンドでのパイプラインの作り直しは派生クラスを参照するので、破棄される前に完了を待つ (Background pipeline recreation refers to derived class, so wait for completion before destroyed)
+	virtual ~DisplacementVK() { Shutdown(); }
 
 	virtual void CreateGeometry() override {
 		Super::CreateGeometry({
-			//!< [Pass0] ItXN[` (ebZ[VA}`r[) p 
+			//!< [Pass0] オフスクリーン描画 (テッセレーション、マルチビュー) 用 
 			Super::GeometryCreateInfo({.VtxCount = 1, .InstCount = 1 }),
 
-			//!< [Pass1] tXN[`p
+			//!< [Pass1] フルスクリーン描画用
+			Super::GeometryCreateInfo({.VtxCount = 4, .InstCount = 1 }),
+#ifdef USE_PIPELINE_FALLBACK
+			//!< [Pass0] フォールバック (テッセレーション無しの矩形) 用
 			Super::GeometryCreateInfo({.VtxCount = 4, .InstCount = 1 }),
+#endif
 		});
 	}
 
 	virtual void CreateUniformBuffer() override {
-		//!< [Pass0] }`r[vWFNVobt@
+		//!< [Pass0] マルチビュープロジェクションバッファ
 		CreateHostVisibleBuffer(UniformBuffers.emplace_back(), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(ViewProjectionBuffer), &ViewProjectionBuffer);
 	
-		//!< [Pass1] `L[A[hobt@
+		//!< [Pass1] レンチキュラー、ワールドバッファ
 		CreateHostVisibleBuffer(UniformBuffers.emplace_back(), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(LenticularBuffer), &LenticularBuffer);
 		CreateHostVisibleBuffer(UniformBuffers.emplace_back(), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(WorldBuffer), &WorldBuffer);	
 	}
 	
 	virtual void CreateDisplacementTexture() = 0;
 	virtual void CreateTexture() override {
-		//!< [Pass0] _[^[Qbg (fvXeXgL) [0, 1]
-		CreateTexture_Render(VK_FORMAT_B8G8R8A8_UNORM, QuiltX, QuiltY);
-		CreateTexture_Depth(VK_FORMAT_D24_UNORM_S8_UINT, QuiltX, QuiltY);
+		//!< [Pass0] レンダーターゲット (デプステスト有) [0, 1]
+		CreateTexture_Render(QuiltColorFormat, QuiltX, QuiltY);
+		CreateTexture_Depth(QuiltDepthFormat, QuiltX, QuiltY);
 
-		//!< fBXv[Xg}bv (J[A[x) ǂݍ [2, 3]
+		//!< ディスプレースメントマップ (カラー、深度) 読み込み [2, 3]
 		CreateDisplacementTexture();
 	}
 	void CreateCommandBuffer() override {
-		//!< vC}
+		//!< プライマリ
 		AllocateCommandBuffers(CreateCommandPool(PrimaryCommandBuffers), std::size(Swapchain.ImageAndViews), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 		
-		//!< [Pass0] ItXN[ (ebZ[VA}`r[) `pZJ_
+		//!< [Pass0] オフスクリーン (テッセレーション、マルチビュー) 描画用セカンダリ
 		AllocateCommandBuffers(CreateCommandPool(SecondaryCommandBuffers), std::size(Swapchain.ImageAndViews), VK_COMMAND_BUFFER_LEVEL_SECONDARY);
-		//!< [Pass1] tXN[`pZJ_
+		//!< [Pass1] フルスクリーン描画用セカンダリ
 		AllocateCommandBuffers(CreateCommandPool(SecondaryCommandBuffers), std::size(Swapchain.ImageAndViews), VK_COMMAND_BUFFER_LEVEL_SECONDARY);
 	}
+	//!< 仮想テクスチャ、テクスチャマップ、ディスプレースメントマップは物理ページアトラスになり、ページテーブル等を (set = 1) で参照する
+	//!< (Virtual texture, color map and displacement map become physical page atlases, page table etc. are accessed via (set = 1))
+	virtual bool IsVirtualTexture() const { return false; }
+	//!< USE_BINDLESS 定義時、デバイスがサポートしていればバインドレス (Bindless if USE_BINDLESS is defined and device supports)
+	bool IsBindless() const {
+#ifdef USE_BINDLESS
+		return HasBindless && !IsVirtualTexture();
+#else
+		return false;
+#endif
+	}
+
+	//!< USE_PUSH_DESCRIPTOR 定義時、デバイスがサポートしていればプッシュデスクリプタ (Push descriptor if USE_PUSH_DESCRIPTOR is defined and device supports)
+	bool IsPushDescriptor() const {
+#ifdef USE_PUSH_DESCRIPTOR
+		return HasPushDescriptor && !IsVirtualTexture();
+#else
+		return false;
+#endif
+	}
+	//!< USE_MIPMAP 定義時、カラーマップのミップを作成する (フォーマットがブリットをサポートしない場合は作成されない)
+	//!< (Generate mips of color map if USE_MIPMAP is defined (not generated if format does not support blit))
+	static constexpr bool IsMipmap() {
+#ifdef USE_MIPMAP
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	virtual void CreatePipelineLayout() override {
 		CreateSamplerLR();
 
-		//!< [Pass0] [0]}`r[vWFNVobt@A[1]eNX`}bvA[2]fBXv[Xg}bvA[3][hobt@
+		//!< プッシュデスクリプタではダイナミックバッファが使えないので、ビューポートチャンク毎にオフセットを変えてプッシュする
+		//!< (Dynamic buffer is not allowed in push descriptor, push with different offset per viewport chunk instead)
+		const VkDescriptorSetLayoutCreateFlags DSLCF = IsPushDescriptor() ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+		const auto VPType = IsPushDescriptor() ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+		//!< [Pass0] [0]マルチビュープロジェクションバッファ、[1]テクスチャマップ、[2]ディスプレースメントマップ、[3]ワールドバッファ
 		const std::array ISs = { Samplers[0] };
-		Super::CreatePipelineLayout({
+		const auto DSL_Pass0 = IsBindless() ?
 			CreateDescriptorSetLayout({
 				//!< [0](UB) ViewProjection
-				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_GEOMETRY_BIT, .pImmutableSamplers = nullptr }),
+				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VPType, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_VERTEX_BIT, .pImmutableSamplers = nullptr }),
+				//!< [3](UB) World
+				VkDescriptorSetLayoutBinding({.binding = 3, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_VERTEX_BIT, .pImmutableSamplers = nullptr }),
+			}, DSLCF) :
+			CreateDescriptorSetLayout({
+				//!< [0](UB) ViewProjection
+				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VPType, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_VERTEX_BIT, .pImmutableSamplers = nullptr }),
 				//!< [1](S2D) Color
 				VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = static_cast<uint32_t>(std::size(ISs)), .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT, .pImmutableSamplers = std::data(ISs) }),
 				//!< [2](S2D) Displacement
 				VkDescriptorSetLayoutBinding({.binding = 2, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = static_cast<uint32_t>(std::size(ISs)), .stageFlags = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, .pImmutableSamplers = std::data(ISs) }),
 				//!< [3](UB) World
-				VkDescriptorSetLayoutBinding({.binding = 3, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, .pImmutableSamplers = nullptr }),
-			})
-		});
-
-		//!< [Pass1] [0s]LgeNX`}bvA[1]`L[obt@
-		Super::CreatePipelineLayout({
-			CreateDescriptorSetLayout({
-				//!< [0](S2D) Quilt
-				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = static_cast<uint32_t>(std::size(ISs)), .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT, .pImmutableSamplers = std::data(ISs) }),
-				//!< [1](UB) Lenticular
-				VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT, .pImmutableSamplers = nullptr }),
-			})
-		});
+				VkDescriptorSetLayoutBinding({.binding = 3, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_VERTEX_BIT, .pImmutableSamplers = nullptr }),
+			}, DSLCF);
+
+		//!< [Pass1] [0s]キルトテクスチャマップ、[1]レンチキュラーバッファ
+		const auto DSL_Pass1 = CreateDescriptorSetLayout({
+			//!< [0](S2D) Quilt
+			VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = static_cast<uint32_t>(std::size(ISs)), .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT, .pImmutableSamplers = std::data(ISs) }),
+			//!< [1](UB) Lenticular
+			VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT, .pImmutableSamplers = nullptr }),
+		}, DSLCF);
+
+		if (IsBindless()) {
+			//!< テクスチャはグローバルなデスクリプタセット (set = 1) からプッシュ定数のインデックスで参照する (Textures are accessed from global descriptor set (set = 1) via index in push constant)
+			CreateBindlessDescriptor();
+			Super::CreatePipelineLayout({ DSL_Pass0, Bindless.DescriptorSetLayout }, {
+				VkPushConstantRange({.stageFlags = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, .offset = 0, .size = sizeof(BindlessIndex) }),
+			});
+		}
+		else if (IsVirtualTexture()) {
+			//!< 仮想テクスチャ (set = 1) は DescriptorSetLayouts[2] になる (Virtual texture (set = 1) becomes DescriptorSetLayouts[2])
+			constexpr auto SSF = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+			Super::CreatePipelineLayout({
+				DSL_Pass0,
+				CreateDescriptorSetLayout({
+					//!< [0](SB) PageTable
+					VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1, .stageFlags = SSF, .pImmutableSamplers = nullptr }),
+					//!< [1](SB) Feedback
+					VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1, .stageFlags = SSF, .pImmutableSamplers = nullptr }),
+					//!< [2](UB) VirtualTextureInfo
+					VkDescriptorSetLayoutBinding({.binding = 2, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1, .stageFlags = SSF, .pImmutableSamplers = nullptr }),
+				}),
+			});
+		}
+		else {
+			Super::CreatePipelineLayout({ DSL_Pass0 });
+		}
+		Super::CreatePipelineLayout({ DSL_Pass1 });
 	}
 	
 	virtual void CreateRenderPass() override {
-		//!< [Pass0] ItXN[ (ebZ[VA}`r[) (fvXeXgL)
-		Super::CreateRenderPass_Depth(VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+#ifndef USE_DYNAMIC_RENDERING
+		//!< レイアウト遷移はフレームグラフで行うため、レンダーパスではアタッチメントレイアウトのままにする (Layout transitions are done by frame graph, keep attachment layout in render pass)
+
+		//!< [Pass0] オフスクリーン (テッセレーション、マルチビュー) (デプステスト有)
+		Super::CreateRenderPass_Depth(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
-		//!< [Pass1] tXN[ (NAsv)
-		Super::CreateRenderPass_None();
+		//!< [Pass1] フルスクリーン (クリア不要)
+		Super::CreateRenderPass_None(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+#endif
 	}
 
+	virtual std::filesystem::path GetShaderDirectory() const override { return std::filesystem::path("..") / ".." / "Shaders"; }
+#ifdef USE_PIPELINE_FALLBACK
 	virtual void CreatePipeline() override {
-		Pipelines.emplace_back();
-		Pipelines.emplace_back();
-
-		std::vector<std::thread> Threads = {};
+		CreatePipeline_Displacement(Pipelines, true);
+		IsFallbackPipeline = true;
+		//!< 本来のパイプラインは完了次第 VK::Render() で差し替わる (Full pipelines are swapped in VK::Render() when done)
+		RecreatePipeline();
+	}
+	virtual bool SwapRecreatedPipelines() override {
+		if (!Super::SwapRecreatedPipelines()) { return false; }
+		IsFallbackPipeline = false;
+		return true;
+	}
+#endif
+	virtual void CreatePipeline(std::vector<VkPipeline>& PLs) override {
+		CreatePipeline_Displacement(PLs, false);
+	}
+	//!< フォールバックはテッセレーション、ジオメトリシェーダ (マルチビューポート) を使わず、ビュープロジェクションを頂点シェーダで適用した平坦な矩形を
+	//!< ドローコール毎の先頭のタイルにのみ描画し、キルトをそのまま表示する
+	//!< (Fallback does not use tessellation, geometry shader (multi viewport), draws flat quad with view projection applied in vertex shader
+	//!< only into first tile of each draw call, and displays quilt as is)
+	void CreatePipeline_Displacement(std::vector<VkPipeline>& PLs, const bool IsFallback) {
+		PLs.emplace_back();
+		PLs.emplace_back();
+
+		std::vector<JobSystem::JobHandle> Jobs = {};
+
+#ifdef USE_DYNAMIC_RENDERING
+		//!< レンダーパスの代わりにアタッチメントのフォーマットを指定する (Specify attachment formats instead of render pass)
+		const std::array CAFs_Pass0 = { QuiltColorFormat };
+		const VkPipelineRenderingCreateInfo PRCI_Pass0 = {
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+			.pNext = nullptr,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs_Pass0)), .pColorAttachmentFormats = std::data(CAFs_Pass0),
+			.depthAttachmentFormat = QuiltDepthFormat,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED
+		};
+		const std::array CAFs_Pass1 = { SelectedSurfaceFormat.format };
+		const VkPipelineRenderingCreateInfo PRCI_Pass1 = {
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+			.pNext = nullptr,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs_Pass1)), .pColorAttachmentFormats = std::data(CAFs_Pass1),
+			.depthAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED
+		};
+		const std::array<VkRenderPass, 2> RPs = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+		const std::array PRCIs = { &PRCI_Pass0, &PRCI_Pass1 };
+#else
+		const std::array RPs = { RenderPasses[0], RenderPasses[1] };
+		const std::array<const VkPipelineRenderingCreateInfo*, 2> PRCIs = { nullptr, nullptr };
+#endif
 
-		const auto BasePath = std::filesystem::path("..") / ".." / "Shaders";
-		//!< [Pass0] ItXN[ (ebZ[VA}`r[)
+		const auto BasePath = GetShaderDirectory();
+		//!< [Pass0] オフスクリーン (テッセレーション、マルチビュー)
 		const std::array SMs_Pass0 = {
-			CreateShaderModule(BasePath / "Views.vert.spv"),
-			CreateShaderModule(BasePath / "Views.frag.spv"),
-			CreateShaderModule(BasePath / "Views.tese.spv"),
-			CreateShaderModule(BasePath / "Views.tesc.spv"),
-			CreateShaderModule(BasePath / "Views.geom.spv"),
-		};
-		Threads.emplace_back(std::thread([&] {
-			VK::CreatePipeline(Pipelines[0],
-				SMs_Pass0[0], SMs_Pass0[1], SMs_Pass0[2], SMs_Pass0[3], SMs_Pass0[4],
-				PipelineLayouts[0],
-				RenderPasses[0]);
+			IsFallback ? CreateShaderModule(BasePath / "ViewsFallback.vert.spv", EMBEDDED_SPIRV(ViewsFallback_vert)) : CreateShaderModule(BasePath / "Views.vert.spv", EMBEDDED_SPIRV(Views_vert)),
+			IsBindless() ? CreateShaderModule(BasePath / "ViewsBindless.frag.spv", EMBEDDED_SPIRV(ViewsBindless_frag)) : (IsVirtualTexture() ? CreateShaderModule(BasePath / "ViewsVirtual.frag.spv", EMBEDDED_SPIRV(ViewsVirtual_frag)) : CreateShaderModule(BasePath / "Views.frag.spv", EMBEDDED_SPIRV(Views_frag))),
+			IsFallback ? VK_NULL_HANDLE : (IsBindless() ? CreateShaderModule(BasePath / "ViewsBindless.tese.spv", EMBEDDED_SPIRV(ViewsBindless_tese)) : (IsVirtualTexture() ? CreateShaderModule(BasePath / "ViewsVirtual.tese.spv", EMBEDDED_SPIRV(ViewsVirtual_tese)) : CreateShaderModule(BasePath / "Views.tese.spv", EMBEDDED_SPIRV(Views_tese)))),
+			IsFallback ? VK_NULL_HANDLE : CreateShaderModule(BasePath / "Views.tesc.spv", EMBEDDED_SPIRV(Views_tesc)),
+			IsFallback ? VK_NULL_HANDLE : CreateShaderModule(BasePath / "Views.geom.spv", EMBEDDED_SPIRV(Views_geom)),
+		};
+		//!< テッセレーションレベル (Tessellation level)
+		Specialization TescSpec(std::array{ (std::min)(256.0f, static_cast<float>(SelectedPhysDevice.second.PDP.limits.maxTessellationGenerationLevel)) });
+		//!< ビュープロジェクション数、1 ドローコールあたりのビューポート数 (ジオメトリシェーダの invocations (16) 以下) (View projection count, viewports per draw call (up to GS invocations (16)))
+		Specialization GeomSpec(std::array{ TileDimensionMax, static_cast<int>((std::min)(GetMaxViewports(), 16u)) });
+		Jobs.emplace_back(JobSystem::Get().Schedule([&] {
+			if (IsFallback) {
+				VK::CreatePipeline(PLs[0],
+					SMs_Pass0[0], SMs_Pass0[1], VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE,
+					{}, {},
+					VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+					0,
+					VK_POLYGON_MODE_FILL, VK_CULL_MODE_NONE, VK_FRONT_FACE_COUNTER_CLOCKWISE,
+					VK_TRUE,
+					PipelineLayouts[0],
+					RPs[0],
+					{},
+					PRCIs[0]);
+			}
+			else {
+				VK::CreatePipeline(PLs[0],
+					SMs_Pass0[0], SMs_Pass0[1], SMs_Pass0[2], SMs_Pass0[3], SMs_Pass0[4],
+					PipelineLayouts[0],
+					RPs[0],
+					{ nullptr, nullptr, nullptr, TescSpec.Get(), GeomSpec.Get() },
+					PRCIs[0]);
+			}
 			}));
 
-		//!< [Pass1] tXN[ 
+		//!< [Pass1] フルスクリーン 
 		const std::array SMs_Pass1 = {
-			CreateShaderModule(BasePath / "Quilt.vert.spv"),
+			CreateShaderModule(BasePath / "Quilt.vert.spv", EMBEDDED_SPIRV(Quilt_vert)),
 #ifdef DISPLAY_QUILT
-			CreateShaderModule(BasePath / "QuiltRaw.frag.spv"),
+			CreateShaderModule(BasePath / "QuiltRaw.frag.spv", EMBEDDED_SPIRV(QuiltRaw_frag)),
 #else
-			CreateShaderModule(BasePath / "Quilt.frag.spv"),
+			IsFallback ? CreateShaderModule(BasePath / "QuiltRaw.frag.spv", EMBEDDED_SPIRV(QuiltRaw_frag)) : CreateShaderModule(BasePath / "Quilt.frag.spv", EMBEDDED_SPIRV(Quilt_frag)),
 #endif
 		};
-		Threads.emplace_back(std::thread([&] {
-			VK::CreatePipeline(Pipelines[1],
+		//!< タイル数、チャンネル順 (Tile count, channel order)
+		Specialization FragSpec(std::array{ GetTileX(), GetTileY(), LenticularBuffer.Ri, LenticularBuffer.Bi });
+		Jobs.emplace_back(JobSystem::Get().Schedule([&] {
+			VK::CreatePipeline(PLs[1],
 				SMs_Pass1[0], SMs_Pass1[1],
 				PipelineLayouts[1],
-				RenderPasses[1]);
+				RPs[1],
+				{ nullptr, FragSpec.Get(), nullptr, nullptr, nullptr },
+				PRCIs[1]);
 			}));
 
-		for (auto& i : Threads) { i.join(); }
+		JobSystem::Get().Wait(Jobs);
 
 		for (const auto i : SMs_Pass1) {
 			vkDestroyShaderModule(Device, i, nullptr);
@@ -271,13 +461,19 @@ public:
 		for (const auto i : SMs_Pass0) {
 			vkDestroyShaderModule(Device, i, nullptr);
 		}
+
+		CreatePipeline_Compute(PLs);
 	}
+	//!< [2 以降] 描画前にテクスチャを更新するコンピュートパイプライン (作り直しの対象になるのでここで作成する)
+	//!< (Compute pipelines updating textures before rendering, created here so that they are recreated too)
+	virtual void CreatePipeline_Compute([[maybe_unused]] std::vector<VkPipeline>& PLs) {}
 
 	virtual void CreateFramebuffer() override {
-		//!< ItXN[ + tXN[ (Xbv`FC)
+#ifndef USE_DYNAMIC_RENDERING
+		//!< オフスクリーン + フルスクリーン (スワップチェイン数)
 		Framebuffers.reserve(1 + std::size(Swapchain.ImageAndViews));
 
-		//!< [Pass0] ItXN[ (ebZ[VA}`r[)
+		//!< [Pass0] オフスクリーン (テッセレーション、マルチビュー)
 		{
 			const auto RP = RenderPasses[0];
 			const auto RTCV = GetRTColor().ImageView.second;
@@ -296,130 +492,188 @@ public:
 			VERIFY_SUCCEEDED(vkCreateFramebuffer(Device, &FCI, nullptr, &Framebuffers.emplace_back()));
 		}
 
-		//!< [Pass1] tXN[
+		//!< [Pass1] フルスクリーン
 		Super::CreateFramebuffer(RenderPasses[1]);
+#endif
 	}
 
 	void CreateDescriptor_Pass0() {
+		if (IsBindless()) {
+			//!< テクスチャはグローバルなデスクリプタセットに登録し、以降はインデックスで参照する (Register textures to global descriptor set, then access via index)
+			BindlessIndex = BINDLESS_INDEX({
+				.ColorMap = RegisterBindlessImage(GetColorMap().ImageView.second, Samplers[0]),
+				.DisplacementMap = RegisterBindlessImage(GetDisplacementMap().ImageView.second, Samplers[0]),
+			});
+		}
+		//!< プッシュデスクリプタの場合はセットを確保しない (In case push descriptor, set is not allocated)
+		if (IsPushDescriptor()) { return; }
+
 		const auto DSL = DescriptorSetLayouts[0];
 
-		AllocateDescriptorSets(
-			CreateDescriptorPool({
-				//!< }`r[vWFNVobt@
-				VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = 1 }),
-				//!< eNX`}bvAfBXv[Xg}bv
-				VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = 2 }),
-				//!< [hobt@
-				VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1 }),
-				}),
-			{ DSL });
-		{
-			const auto DynamicOffset = GetMaxViewports() * sizeof(ViewProjectionBuffer[0]);
+		const auto DS = DescriptorSets.emplace_back(DescriptorSetAllocator.Allocate(DSL));
 
-			const auto UB_0 = GetViewProjectionBuffer().first;
-			const auto IV_0 = GetColorMap().ImageView.second;
-			const auto IV_1 = GetDisplacementMap().ImageView.second;
-			const auto UB_2 = GetWorldBuffer().first;
+		const auto DynamicOffset = GetMaxViewports() * sizeof(ViewProjectionBuffer[0]);
+		const auto UB_0 = GetViewProjectionBuffer().first;
+		const auto UB_2 = GetWorldBuffer().first;
 
-			const auto DS = DescriptorSets[0];
+		if (IsBindless()) {
 
 			struct DescriptorUpdateInfo {
 				VkDescriptorBufferInfo DBI_0[1];
-				VkDescriptorImageInfo DII_0[1];
-				VkDescriptorImageInfo DII_1[1];
 				VkDescriptorBufferInfo DBI_1[1];
 			};
 			const auto DUI = DescriptorUpdateInfo({
-				//!< _Ci~bNItZbg (UNIFORM_BUFFER_DYNAMIC) gpꍇA.range ɂ VK_WHOLE_SIZE ł͖ItZbgɎgpTCYw肷
 				.DBI_0 = VkDescriptorBufferInfo({.buffer = UB_0, .offset = 0, .range = DynamicOffset }),
-				.DII_0 = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV_0, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
-				.DII_1 = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV_1, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
 				.DBI_1 = VkDescriptorBufferInfo({.buffer = UB_2, .offset = 0, .range = VK_WHOLE_SIZE }),
 				});
-			VkDescriptorUpdateTemplate DUT;
-			CreateDescriptorUpdateTemplate(DUT, {
+			vkUpdateDescriptorSetWithTemplate(Device, DS, GetDescriptorUpdateTemplate(DSL, {
 				VkDescriptorUpdateTemplateEntry({
 					.dstBinding = 0, .dstArrayElement = 0,
 					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI_0)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
 					.offset = offsetof(DescriptorUpdateInfo, DBI_0), .stride = sizeof(DUI)
 				}),
-				VkDescriptorUpdateTemplateEntry({
-					.dstBinding = 1, .dstArrayElement = 0,
-					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII_0)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-					.offset = offsetof(DescriptorUpdateInfo, DII_0), .stride = sizeof(DUI)
-				}),
-				VkDescriptorUpdateTemplateEntry({
-					.dstBinding = 2, .dstArrayElement = 0,
-					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII_1)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-					.offset = offsetof(DescriptorUpdateInfo, DII_1), .stride = sizeof(DUI)
-				}),
 				VkDescriptorUpdateTemplateEntry({
 					.dstBinding = 3, .dstArrayElement = 0,
 					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI_1)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
 					.offset = offsetof(DescriptorUpdateInfo, DBI_1), .stride = sizeof(DUI)
 				}),
-				}, DSL);
-			vkUpdateDescriptorSetWithTemplate(Device, DS, DUT, &DUI);
-			vkDestroyDescriptorUpdateTemplate(Device, DUT, nullptr);
+				}), &DUI);
+			return;
 		}
+
+		const auto IV_0 = GetColorMap().ImageView.second;
+		const auto IV_1 = GetDisplacementMap().ImageView.second;
+
+		struct DescriptorUpdateInfo {
+			VkDescriptorBufferInfo DBI_0[1];
+			VkDescriptorImageInfo DII_0[1];
+			VkDescriptorImageInfo DII_1[1];
+			VkDescriptorBufferInfo DBI_1[1];
+		};
+		const auto DUI = DescriptorUpdateInfo({
+			//!< ダイナミックオフセット (UNIFORM_BUFFER_DYNAMIC) を使用する場合、.range には VK_WHOLE_SIZE では無くオフセット毎に使用するサイズを指定する
+			.DBI_0 = VkDescriptorBufferInfo({.buffer = UB_0, .offset = 0, .range = DynamicOffset }),
+			.DII_0 = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV_0, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+			.DII_1 = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV_1, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+			.DBI_1 = VkDescriptorBufferInfo({.buffer = UB_2, .offset = 0, .range = VK_WHOLE_SIZE }),
+			});
+		//!< テンプレートはレイアウト毎にキャッシュされるので、テクスチャ差し替え時等に再度呼んでも作成し直さない (Template is cached per layout, not recreated when called again e.g. on texture replacement)
+		vkUpdateDescriptorSetWithTemplate(Device, DS, GetDescriptorUpdateTemplate(DSL, {
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 0, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI_0)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+				.offset = offsetof(DescriptorUpdateInfo, DBI_0), .stride = sizeof(DUI)
+			}),
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 1, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII_0)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+				.offset = offsetof(DescriptorUpdateInfo, DII_0), .stride = sizeof(DUI)
+			}),
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 2, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII_1)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+				.offset = offsetof(DescriptorUpdateInfo, DII_1), .stride = sizeof(DUI)
+			}),
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 3, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI_1)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+				.offset = offsetof(DescriptorUpdateInfo, DBI_1), .stride = sizeof(DUI)
+			}),
+			}), &DUI);
 	}
 	void CreateDescriptor_Pass1() {
+		//!< プッシュデスクリプタの場合はセットを確保しない (In case push descriptor, set is not allocated)
+		if (IsPushDescriptor()) { return; }
+
 		const auto DSL = DescriptorSetLayouts[1];
 
-		AllocateDescriptorSets(
-			CreateDescriptorPool({
-				//!< LgeNX`}bv
-				VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = 1 }),
-				//!< `L[obt@
-				VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1 }),
-				}),
-			{ DSL });
-		{			
-			const auto IV = GetRTColor().ImageView.second;
-			const auto UB = GetLenticularBuffer().first;
+		const auto DS = DescriptorSets.emplace_back(DescriptorSetAllocator.Allocate(DSL));
 
-			const auto DS = DescriptorSets[1];
+		const auto IV = GetRTColor().ImageView.second;
+		const auto UB = GetLenticularBuffer().first;
 
-			struct DescriptorUpdateInfo {
-				VkDescriptorImageInfo DII[1];
-				VkDescriptorBufferInfo DBI[1];
-			};
-			const auto DUI = DescriptorUpdateInfo({
-				.DII = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
-				.DBI = VkDescriptorBufferInfo({.buffer = UB, .offset = 0, .range = VK_WHOLE_SIZE}),
-				});
-			VkDescriptorUpdateTemplate DUT;
-			CreateDescriptorUpdateTemplate(DUT, {
-				VkDescriptorUpdateTemplateEntry({
-					.dstBinding = 0, .dstArrayElement = 0,
-					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-					.offset = offsetof(DescriptorUpdateInfo, DII), .stride = sizeof(DUI)
-				}),
-				VkDescriptorUpdateTemplateEntry({
-					.dstBinding = 1, .dstArrayElement = 0,
-					.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-					.offset = offsetof(DescriptorUpdateInfo, DBI), .stride = sizeof(DUI)
-				}),
-				}, DSL);
-			vkUpdateDescriptorSetWithTemplate(Device, DS, DUT, &DUI);
-			vkDestroyDescriptorUpdateTemplate(Device, DUT, nullptr);
+		struct DescriptorUpdateInfo {
+			VkDescriptorImageInfo DII[1];
+			VkDescriptorBufferInfo DBI[1];
+		};
+		const auto DUI = DescriptorUpdateInfo({
+			.DII = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = IV, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+			.DBI = VkDescriptorBufferInfo({.buffer = UB, .offset = 0, .range = VK_WHOLE_SIZE}),
+			});
+		vkUpdateDescriptorSetWithTemplate(Device, DS, GetDescriptorUpdateTemplate(DSL, {
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 0, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DII)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+				.offset = offsetof(DescriptorUpdateInfo, DII), .stride = sizeof(DUI)
+			}),
+			VkDescriptorUpdateTemplateEntry({
+				.dstBinding = 1, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DUI.DBI)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+				.offset = offsetof(DescriptorUpdateInfo, DBI), .stride = sizeof(DUI)
+			}),
+			}), &DUI);
+	}
+	//!< 非同期読み込みしたテクスチャへ差し替わった (Replaced with asynchronously loaded textures)
+	virtual void UpdateTextureDescriptor() override {
+		if (IsBindless()) {
+			//!< ハンドルはそのままで中身を差し替えるので、プッシュ定数は変わらない (Handles are kept and contents are replaced, so push constants are unchanged)
+			UpdateBindlessImage(BindlessIndex.ColorMap, GetColorMap().ImageView.second, Samplers[0]);
+			UpdateBindlessImage(BindlessIndex.DisplacementMap, GetDisplacementMap().ImageView.second, Samplers[0]);
+			return;
 		}
+		//!< プッシュデスクリプタの場合はコマンドバッファの再記録で反映される (In case push descriptor, reflected by re-recording command buffers)
+		if (IsPushDescriptor()) { return; }
+
+		const std::array DIIs = {
+			VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = GetColorMap().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+			VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = GetDisplacementMap().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+		};
+		//!< バインディング 1, 2 のみ更新する (Update bindings 1, 2 only)
+		const std::array WDSs = {
+			VkWriteDescriptorSet({
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.pNext = nullptr,
+				.dstSet = DescriptorSets[0],
+				.dstBinding = 1, .dstArrayElement = 0,
+				.descriptorCount = static_cast<uint32_t>(std::size(DIIs)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+				.pImageInfo = std::data(DIIs), .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+			}),
+		};
+		vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
 	}
 	virtual void CreateDescriptor() override {
-		//!< [Pass0] ItXN[ (ebZ[VA}`r[)
+		//!< [Pass0] オフスクリーン (テッセレーション、マルチビュー)
 		CreateDescriptor_Pass0();
 
-		//!< [Pass1] tXN[
+		//!< [Pass1] フルスクリーン
 		CreateDescriptor_Pass1();
 	}
 
 	void PopulateSecondaryCommandBuffer_Pass0(const int i) {
-		const auto RP = RenderPasses[0];
 		const auto CB = SecondaryCommandBuffers[0].second[i];
 
+#ifdef USE_DYNAMIC_RENDERING
+		//!< レンダーパスの代わりにアタッチメントのフォーマットを継承する (Inherit attachment formats instead of render pass)
+		const std::array CAFs = { QuiltColorFormat };
+		const VkCommandBufferInheritanceRenderingInfo CBIRI = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+			.pNext = nullptr,
+			.flags = 0,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs)), .pColorAttachmentFormats = std::data(CAFs),
+			.depthAttachmentFormat = QuiltDepthFormat,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT
+		};
+		const VkRenderPass RP = VK_NULL_HANDLE;
+		const void* pNext = &CBIRI;
+#else
+		const auto RP = RenderPasses[0];
+		const void* pNext = nullptr;
+#endif
 		const VkCommandBufferInheritanceInfo CBII = {
 			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
-			.pNext = nullptr,
+			.pNext = pNext,
 			.renderPass = RP,
 			.subpass = 0,
 			.framebuffer = VK_NULL_HANDLE,
@@ -435,6 +689,11 @@ public:
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
 			const auto PL = Pipelines[0];
 			vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PL);
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+			//!< ワイヤーフレーム等はここを変えるだけで良い (For wireframe etc., just change here)
+			//!< フォールバックパイプラインの作成時の値 (ストリップ、カリング無し) に合わせる (Match values at creation of fallback pipeline (strip, no culling))
+			SetDynamicState(CB, { .Topology = IsFallbackPipeline ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_PATCH_LIST, .CullMode = static_cast<VkCullModeFlags>(IsFallbackPipeline ? VK_CULL_MODE_NONE : VK_CULL_MODE_BACK_BIT), .DepthEnable = VK_TRUE });
+#endif
 
 			const auto DynamicOffset = GetMaxViewports() * sizeof(ViewProjectionBuffer[0]);
 			const VkBufferMemoryRequirementsInfo2 BMRI = {
@@ -449,10 +708,23 @@ public:
 			};
 			vkGetBufferMemoryRequirements2(Device, &BMRI, &MR);
 			const auto PLL = PipelineLayouts[0];
-			const auto DS = DescriptorSets[0];
-			const auto IDB = IndirectBuffers[0].first;
+			const auto DS = IsPushDescriptor() ? VK_NULL_HANDLE : DescriptorSets[0];
+			//!< フォールバックは矩形 (4 頂点) を描画する (Fallback draws quad (4 vertices))
+			const auto IDB = IndirectBuffers[IsFallbackPipeline ? 2 : 0].first;
+
+			//!< バインドレスの場合、グローバルなデスクリプタセットとインデックスは一度だけ設定する (In case bindless, global descriptor set and indices are set only once)
+			if (IsBindless()) {
+				const std::array DSs = { Bindless.DescriptorSet };
+				vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 1, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), 0, nullptr);
+				vkCmdPushConstants(CB, PLL, VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(BindlessIndex), &BindlessIndex);
+			}
+			//!< 仮想テクスチャのセットは派生クラスが DescriptorSets[2] に作成する (Set of virtual texture is created into DescriptorSets[2] by derived class)
+			if (IsVirtualTexture()) {
+				const std::array DSs = { DescriptorSets[2] };
+				vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 1, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), 0, nullptr);
+			}
 
-			//!< }`r[ (Lg) ` 
+			//!< マルチビュー (キルト) 描画 
 			for (uint32_t j = 0; j < GetViewportDrawCount(); ++j) {
 				const auto Offset = GetViewportSetOffset(j);
 				const auto Count = GetViewportSetCount(j);
@@ -460,21 +732,90 @@ public:
 				vkCmdSetViewport(CB, 0, Count, &QuiltViewports[Offset]);
 				vkCmdSetScissor(CB, 0, Count, &QuiltScissorRects[Offset]);
 
-				const std::array DSs = { DS };
-				const std::array DynamicOffsets = { static_cast<uint32_t>(RoundUp(DynamicOffset * j, MR.memoryRequirements.alignment)) };
-				vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), static_cast<uint32_t>(std::size(DynamicOffsets)), std::data(DynamicOffsets));
+				if (IsPushDescriptor()) {
+					//!< セットを確保、再バインドせず、チャンク毎のオフセットでコマンドバッファへ直接書き込む (Write directly into command buffer with offset per chunk, without allocating or rebinding set)
+					const std::array DBIs = {
+						VkDescriptorBufferInfo({.buffer = GetViewProjectionBuffer().first, .offset = RoundUp(DynamicOffset * j, MR.memoryRequirements.alignment), .range = DynamicOffset }),
+						VkDescriptorBufferInfo({.buffer = GetWorldBuffer().first, .offset = 0, .range = VK_WHOLE_SIZE }),
+					};
+					const std::array DIIs = {
+						VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = GetColorMap().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+						VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = GetDisplacementMap().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }),
+					};
+					std::vector WDSs = {
+						VkWriteDescriptorSet({
+							.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+							.pNext = nullptr,
+							.dstSet = VK_NULL_HANDLE,
+							.dstBinding = 0, .dstArrayElement = 0,
+							.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+							.pImageInfo = nullptr, .pBufferInfo = &DBIs[0], .pTexelBufferView = nullptr
+						}),
+						VkWriteDescriptorSet({
+							.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+							.pNext = nullptr,
+							.dstSet = VK_NULL_HANDLE,
+							.dstBinding = 3, .dstArrayElement = 0,
+							.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+							.pImageInfo = nullptr, .pBufferInfo = &DBIs[1], .pTexelBufferView = nullptr
+						}),
+					};
+					//!< バインドレスの場合テクスチャはグローバルなデスクリプタセットにある (In case bindless, textures are in global descriptor set)
+					if (!IsBindless()) {
+						WDSs.emplace_back(VkWriteDescriptorSet({
+							.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+							.pNext = nullptr,
+							.dstSet = VK_NULL_HANDLE,
+							.dstBinding = 1, .dstArrayElement = 0,
+							.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+							.pImageInfo = &DIIs[0], .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+						}));
+						WDSs.emplace_back(VkWriteDescriptorSet({
+							.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+							.pNext = nullptr,
+							.dstSet = VK_NULL_HANDLE,
+							.dstBinding = 2, .dstArrayElement = 0,
+							.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+							.pImageInfo = &DIIs[1], .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+						}));
+					}
+					vkCmdPushDescriptorSet(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs));
+				}
+				else {
+					const std::array DSs = { DS };
+					const std::array DynamicOffsets = { static_cast<uint32_t>(RoundUp(DynamicOffset * j, MR.memoryRequirements.alignment)) };
+					vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), static_cast<uint32_t>(std::size(DynamicOffsets)), std::data(DynamicOffsets));
+				}
 
 				vkCmdDrawIndirect(CB, IDB, 0, 1, 0);
 			}
 		}VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 	}
 	void PopulateSecondaryCommandBuffer_Pass1(const int i) {
-		const auto RP = RenderPasses[1];
 		const auto CB = SecondaryCommandBuffers[1].second[i];
 
+#ifdef USE_DYNAMIC_RENDERING
+		//!< レンダーパスの代わりにアタッチメントのフォーマットを継承する (Inherit attachment formats instead of render pass)
+		const std::array CAFs = { SelectedSurfaceFormat.format };
+		const VkCommandBufferInheritanceRenderingInfo CBIRI = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+			.pNext = nullptr,
+			.flags = 0,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(CAFs)), .pColorAttachmentFormats = std::data(CAFs),
+			.depthAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.stencilAttachmentFormat = VK_FORMAT_UNDEFINED,
+			.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT
+		};
+		const VkRenderPass RP = VK_NULL_HANDLE;
+		const void* pNext = &CBIRI;
+#else
+		const auto RP = RenderPasses[1];
+		const void* pNext = nullptr;
+#endif
 		const VkCommandBufferInheritanceInfo CBII = {
 			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
-			.pNext = nullptr,
+			.pNext = pNext,
 			.renderPass = RP,
 			.subpass = 0,
 			.framebuffer = VK_NULL_HANDLE,
@@ -490,43 +831,112 @@ public:
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &SCBBI)); {
 			const auto PL = Pipelines[1];
 			vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PL);
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+			SetDynamicState(CB, {});
+#endif
 
 			const auto PLL = PipelineLayouts[1];
-			const auto DS = DescriptorSets[1];
 			const auto IDB = IndirectBuffers[1].first;
 
 			vkCmdSetViewport(CB, 0, static_cast<uint32_t>(std::size(Viewports)), std::data(Viewports));
 			vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
 
-			const std::array DSs = { DS };
-			constexpr std::array<uint32_t, 0> DynamicOffsets = {};
-			vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), static_cast<uint32_t>(std::size(DynamicOffsets)), std::data(DynamicOffsets));
+			if (IsPushDescriptor()) {
+				const std::array DIIs = { VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = GetRTColor().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL }) };
+				const std::array DBIs = { VkDescriptorBufferInfo({.buffer = GetLenticularBuffer().first, .offset = 0, .range = VK_WHOLE_SIZE }) };
+				const std::array WDSs = {
+					VkWriteDescriptorSet({
+						.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						.pNext = nullptr,
+						.dstSet = VK_NULL_HANDLE,
+						.dstBinding = 0, .dstArrayElement = 0,
+						.descriptorCount = static_cast<uint32_t>(std::size(DIIs)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+						.pImageInfo = std::data(DIIs), .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+					}),
+					VkWriteDescriptorSet({
+						.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						.pNext = nullptr,
+						.dstSet = VK_NULL_HANDLE,
+						.dstBinding = 1, .dstArrayElement = 0,
+						.descriptorCount = static_cast<uint32_t>(std::size(DBIs)), .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+						.pImageInfo = nullptr, .pBufferInfo = std::data(DBIs), .pTexelBufferView = nullptr
+					}),
+				};
+				vkCmdPushDescriptorSet(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs));
+			}
+			else {
+				const std::array DSs = { DescriptorSets[1] };
+				constexpr std::array<uint32_t, 0> DynamicOffsets = {};
+				vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, PLL, 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), static_cast<uint32_t>(std::size(DynamicOffsets)), std::data(DynamicOffsets));
+			}
 
 			vkCmdDrawIndirect(CB, IDB, 0, 1, 0);
 		} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 	}
 	virtual void PopulateSecondaryCommandBuffer(const int i) override {
-		//!<yPass0zItXN[ (ebZ[VA}`r[)
-		PopulateSecondaryCommandBuffer_Pass0(i);
+		//!< パス毎にコマンドプールが別なので並列に記録できる (Each pass has its own command pool, so they can be recorded in parallel)
+		const std::array Jobs = {
+			//!<【Pass0】オフスクリーン (テッセレーション、マルチビュー)
+			JobSystem::Get().Schedule([&] { PopulateSecondaryCommandBuffer_Pass0(i); }),
 
-		//!<yPass1ztXN[
-		PopulateSecondaryCommandBuffer_Pass1(i);
+			//!<【Pass1】フルスクリーン
+			JobSystem::Get().Schedule([&] { PopulateSecondaryCommandBuffer_Pass1(i); }),
+		};
+		JobSystem::Get().Wait(Jobs);
 	}
 	virtual void PopulatePrimaryCommandBuffer_Update([[maybe_unused]] const int i) {
 	}
 	void PopulatePrimaryCommandBuffer_Pass0(const int i) {
 		const auto CB = PrimaryCommandBuffers[0].second[i];
 
+		constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }), VkClearValue({.depthStencil = {.depth = 1.0f, .stencil = 0 } }) };
+#ifdef USE_DYNAMIC_RENDERING
+		const std::array RAIs = {
+			VkRenderingAttachmentInfo({
+				.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+				.pNext = nullptr,
+				.imageView = GetRTColor().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+				.resolveMode = VK_RESOLVE_MODE_NONE, .resolveImageView = VK_NULL_HANDLE, .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+				.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR, .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+				.clearValue = CVs[0]
+			}),
+		};
+		//!< 深度はこのパス内でしか使わないので保存しない (Depth is used only in this pass, so not stored)
+		const VkRenderingAttachmentInfo DepthRAI = {
+			.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+			.pNext = nullptr,
+			.imageView = GetRTDepth().ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+			.resolveMode = VK_RESOLVE_MODE_NONE, .resolveImageView = VK_NULL_HANDLE, .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+			.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR, .storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+			.clearValue = CVs[1]
+		};
+		const VkRenderingInfo RI = {
+			.sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+			.pNext = nullptr,
+			.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT,
+			.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = VkExtent2D({.width = static_cast<uint32_t>(QuiltX), .height = static_cast<uint32_t>(QuiltY) })}), //!< キルトサイズ
+			.layerCount = 1,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(RAIs)), .pColorAttachments = std::data(RAIs),
+			.pDepthAttachment = &DepthRAI,
+			.pStencilAttachment = nullptr
+		};
+		vkCmdBeginRendering(CB, &RI); {
+			const auto SCB = SecondaryCommandBuffers[0].second[i];
+
+			const std::array SCBs = { SCB };
+			vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
+		} vkCmdEndRendering(CB);
+#else
 		const auto RP = RenderPasses[0];
 		const auto FB = Framebuffers[0];
 
-		constexpr std::array CVs = { VkClearValue({.color = { 0.529411793f, 0.807843208f, 0.921568692f, 1.0f } }), VkClearValue({.depthStencil = {.depth = 1.0f, .stencil = 0 } }) };
 		const VkRenderPassBeginInfo RPBI = {
 			.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 			.pNext = nullptr,
 			.renderPass = RP,
 			.framebuffer = FB,
-			.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = VkExtent2D({.width = static_cast<uint32_t>(QuiltX), .height = static_cast<uint32_t>(QuiltY) })}), //!< LgTCY
+			.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = VkExtent2D({.width = static_cast<uint32_t>(QuiltX), .height = static_cast<uint32_t>(QuiltY) })}), //!< キルトサイズ
 			.clearValueCount = static_cast<uint32_t>(size(CVs)), .pClearValues = std::data(CVs)
 		};
 		vkCmdBeginRenderPass(CB, &RPBI, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS); {
@@ -535,10 +945,41 @@ public:
 			const std::array SCBs = { SCB };
 			vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
 		} vkCmdEndRenderPass(CB);
+#endif
 	}
 	void PopulatePrimaryCommandBuffer_Pass1(const int i) {
 		const auto CB = PrimaryCommandBuffers[0].second[i];
 
+#ifdef USE_DYNAMIC_RENDERING
+		//!< 全面を上書きするのでクリア不要 (Whole area is overwritten, no clear needed)
+		const std::array RAIs = {
+			VkRenderingAttachmentInfo({
+				.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+				.pNext = nullptr,
+				.imageView = Swapchain.ImageAndViews[i].second, .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+				.resolveMode = VK_RESOLVE_MODE_NONE, .resolveImageView = VK_NULL_HANDLE, .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+				.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE, .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+				.clearValue = VkClearValue({.color = { 0.0f, 0.0f, 0.0f, 0.0f } })
+			}),
+		};
+		const VkRenderingInfo RI = {
+			.sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+			.pNext = nullptr,
+			.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT,
+			.renderArea = VkRect2D({.offset = VkOffset2D({.x = 0, .y = 0 }), .extent = Swapchain.Extent }),
+			.layerCount = 1,
+			.viewMask = 0,
+			.colorAttachmentCount = static_cast<uint32_t>(std::size(RAIs)), .pColorAttachments = std::data(RAIs),
+			.pDepthAttachment = nullptr,
+			.pStencilAttachment = nullptr
+		};
+		vkCmdBeginRendering(CB, &RI); {
+			const auto SCB = SecondaryCommandBuffers[1].second[i];
+
+			const std::array SCBs = { SCB };
+			vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
+		} vkCmdEndRendering(CB);
+#else
 		const auto RP = RenderPasses[1];
 		const auto FB = Framebuffers[1 + i];
 
@@ -557,10 +998,47 @@ public:
 			const std::array SCBs = { SCB };
 			vkCmdExecuteCommands(CB, static_cast<uint32_t>(std::size(SCBs)), std::data(SCBs));
 		} vkCmdEndRenderPass(CB);
+#endif
+	}
+	//!< パスと読み書きするリソースを宣言する、バリアと実行順はフレームグラフが決める (Declare passes and resources, barriers and order are derived by frame graph)
+	//!< 派生クラスでパスを追加する場合は FG.Find("Quilt") 等でハンドルを取得する (Derived class can add passes, get handles via FG.Find("Quilt") etc.)
+	virtual void PopulateFrameGraph(FrameGraph& FG, const int i) {
+		//!< キルト、前フレームでフラグメントシェーダから読まれている (Quilt, read by fragment shader in previous frame)
+		const auto Quilt = FG.ImportImage("Quilt", GetRTColor().ImageView.first,
+			FrameGraph::Usage({ .Stage = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, .Access = VK_ACCESS_2_NONE, .Layout = VK_IMAGE_LAYOUT_UNDEFINED }));
+		//!< スワップチェイン、VK::Submit() でセマフォを待つステージから開始し、最後にプレゼント用レイアウトへ遷移する
+		//!< (Swapchain, starts from the stage VK::Submit() waits semaphore, transitioned to present layout at the end)
+		const auto Backbuffer = FG.ImportImage("Swapchain", Swapchain.ImageAndViews[i].first,
+			FrameGraph::Usage({ .Stage = VK_PIPELINE_STAGE_2_TRANSFER_BIT, .Access = VK_ACCESS_2_NONE, .Layout = VK_IMAGE_LAYOUT_UNDEFINED }),
+			VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+
+#ifdef USE_DYNAMIC_RENDERING
+		//!< 深度、レンダーパスが行っていたレイアウト遷移をフレームグラフで行う (Depth, layout transition which render pass did is done by frame graph)
+		const auto Depth = FG.ImportImage("Depth", GetRTDepth().ImageView.first,
+			FrameGraph::Usage({ .Stage = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT, .Access = VK_ACCESS_2_NONE, .Layout = VK_IMAGE_LAYOUT_UNDEFINED }),
+			VK_IMAGE_LAYOUT_UNDEFINED,
+			VkImageSubresourceRange({ .aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT, .baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS, .baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS }));
+#endif
+
+		//!<【Pass0】オフスクリーン (テッセレーション、マルチビュー)
+		FG.AddPass("Pass0", [this, i](const VkCommandBuffer) { PopulatePrimaryCommandBuffer_Pass0(i); })
+#ifdef USE_DYNAMIC_RENDERING
+			.Write(Depth, VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
+#endif
+			.Write(Quilt, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+		//!<【Pass1】フルスクリーン
+		FG.AddPass("Pass1", [this, i](const VkCommandBuffer) { PopulatePrimaryCommandBuffer_Pass1(i); })
+			.Read(Quilt, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+			.Write(Backbuffer, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 	}
 	virtual void PopulatePrimaryCommandBuffer(const int i) override {
 		const auto CB = PrimaryCommandBuffers[0].second[i];
 
+		FrameGraph FG;
+		PopulateFrameGraph(FG, i);
+		FG.Compile();
+
 		constexpr VkCommandBufferBeginInfo CBBI = {
 			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
 			.pNext = nullptr,
@@ -568,22 +1046,11 @@ public:
 			.pInheritanceInfo = nullptr
 		};
 		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
-			//!< Abvf[g (eNX`Aj[V)
+			//!< アップデート (テクスチャアニメーション等)
 			PopulatePrimaryCommandBuffer_Update(i);
 
-			//!<yPass0zItXN[ (ebZ[VA}`r[)
-			PopulatePrimaryCommandBuffer_Pass0(i);
-
-			//!< oA
-			ImageMemoryBarrier(CB,
-				GetRTColor().ImageView.first,
-				VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
-				VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT,
-				VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-			//!<yPass1ztXN[
-			PopulatePrimaryCommandBuffer_Pass1(i);
-
+			//!< パス、バリア (Passes, barriers)
+			FG.Execute(CB);
 		} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 	}
 
@@ -716,16 +1183,16 @@ protected:
 		LenticularBuffer.TileX = 2; LenticularBuffer.TileY = 1;
 #endif
 
-		//!<  [Adjustment]
+		//!< 調整 [Adjustment]
 		{
-			//!< DX ł Y łA(ł) VK  DX ɍ킹 Y ɂĂׁATilt ̒l𐳂ɂ邱ƂŒ킹Ă [Here Y is up, so changing tilt value to positive]
+			//!< DX では Y が上であり、(ここでは) VK も DX に合わせて Y が上にしている為、Tilt の値を正にすることで辻褄を合わせている [Here Y is up, so changing tilt value to positive]
 			LenticularBuffer.Tilt *= -1.0f;
 			LenticularBuffer.Center *= -1.0f;
 
-			//!< InvView ͐^U𕄍ɂĕێĂ [Convert truth or falsehood to sign]
+			//!< InvView は真偽を符号にして保持しておく [Convert truth or falsehood to sign]
 			LenticularBuffer.InvView = LenticularBuffer.InvView ? -1 : 1;
-			//!< ̎_ł͊pxĂ̂ŃWAϊ [Convert degree to radian]
-			//!< s悢̂ŔpɂĊoĂ [Save half radian for convenience]
+			//!< この時点では角度が入ってくるのでラジアン変換する [Convert degree to radian]
+			//!< 都合がよいので半角にして覚えておく [Save half radian for convenience]
 			HalfViewCone = TO_RADIAN(HalfViewCone) * 0.5f;
 		}
 
@@ -748,6 +1215,16 @@ protected:
 		float QuiltAspect = 0.75f;
 	};
 	LENTICULAR_BUFFER LenticularBuffer;	
+
+	//!< バインドレス時のテクスチャインデックス (プッシュ定数) (Texture indices in case bindless (push constant))
+	struct BINDLESS_INDEX {
+		BindlessHandle ColorMap = 0;
+		BindlessHandle DisplacementMap = 0;
+	};
+	BINDLESS_INDEX BindlessIndex;
+
+	//!< フォールバックのパイプラインで描画している (本来のパイプラインに差し替わるまで) (Drawing with fallback pipelines (until full pipelines are swapped))
+	bool IsFallbackPipeline = false;
 };
 
 class DisplacementDDSVK : public DisplacementVK
@@ -757,19 +1234,296 @@ private:
 public:
 	DisplacementDDSVK() {}
 	DisplacementDDSVK(const std::filesystem::path& Color, const std::filesystem::path& Depth) : ColorImagePath(Color), DepthImagePath(Depth) {}
+	//!< 非同期の読み込みがメンバを参照しているので、メンバが破棄される前に完了を待つ (Asynchronous load refers to members, so wait for completion before members are destroyed)
+	virtual ~DisplacementDDSVK() { Shutdown(); }
 
 	virtual void CreateDisplacementTexture() override {
+#ifdef USE_ASYNC_TEXTURE
+		//!< 読み込み完了まではプレースホルダ (灰色、平坦) で表示する (Display with placeholders (gray, flat) until loaded)
+		const auto Index = std::size(Textures);
+		const auto CB = PrimaryCommandBuffers[0].second[0];
+		CreatePlaceholderTexture(CB, VkClearColorValue({ .float32 = { 0.5f, 0.5f, 0.5f, 1.0f } }), VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+		CreatePlaceholderTexture(CB, VkClearColorValue({ .float32 = { 0.0f, 0.0f, 0.0f, 0.0f } }), VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT);
+		CreateGLITextureAsync(Index, ColorImagePath, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, IsMipmap());
+		CreateGLITextureAsync(Index + 1, DepthImagePath, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT);
+#else
 		const std::vector Paths = {
 			PathAndPipelineStage({ ColorImagePath, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT }),
 			PathAndPipelineStage({ DepthImagePath, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT }),
 		};
 		CreateGLITextures(PrimaryCommandBuffers[0].second[0], Paths);
+#endif
 	}
 protected:
 	std::filesystem::path ColorImagePath = std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Color.dds";
 	std::filesystem::path DepthImagePath = std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Displacement.dds";
 };
 
+//!< 仮想テクスチャで表示する、巨大なマップでも見えているページのみを常駐させる (Display with virtual texture, only visible pages are resident even for huge maps)
+//!< スパースリソースは使わず、ページテーブル + 物理ページアトラスで行う (Sparse resources are not used, done with page table + physical page atlas)
+//!< デバイスがシェーダからの書き込みをサポートしない、ファイルが扱えない場合は従来通り全体を読み込む
+//!< (If device does not support shader stores or files are not supported, whole maps are loaded as before)
+class VirtualDisplacementVK : public DisplacementDDSVK
+{
+private:
+	using Super = DisplacementDDSVK;
+public:
+	VirtualDisplacementVK() : ColorVT(ColorImagePath, AtlasSlots, AtlasSlots), DisplacementVT(DepthImagePath, AtlasSlots, AtlasSlots) {}
+	VirtualDisplacementVK(const std::filesystem::path& Color, const std::filesystem::path& Depth) : Super(Color, Depth), ColorVT(ColorImagePath, AtlasSlots, AtlasSlots), DisplacementVT(DepthImagePath, AtlasSlots, AtlasSlots) {}
+
+	virtual bool IsVirtualTexture() const override {
+		constexpr auto FFF = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+		return HasShaderStores
+			&& ColorVT.IsValid() && IsSupportedFormat(ToVkFormat(ColorVT.GetFormat()), FFF)
+			&& DisplacementVT.IsValid() && IsSupportedFormat(ToVkFormat(DisplacementVT.GetFormat()), FFF);
+	}
+
+	virtual void CreateUniformBuffer() override {
+		Super::CreateUniformBuffer();
+		if (!IsVirtualTexture()) { return; }
+
+		//!< [Pass0] 仮想テクスチャ情報 (Virtual texture info)
+		const auto VTs = GetVirtualTextures();
+		uint32_t Offset = 0;
+		for (size_t i = 0; i < std::size(VTs); ++i) {
+			VirtualTextureInfo.Info[i] = glm::ivec4(VTs[i]->GetWidth(), VTs[i]->GetHeight(), VTs[i]->GetMaxLevel(), Offset);
+			VirtualTextureInfo.Atlas[i] = glm::ivec4(VTs[i]->GetSlotCountX(), VTs[i]->GetSlotCountY(), 0, 0);
+			Offset += VTs[i]->GetPageCount();
+		}
+		CreateHostVisibleBuffer(UniformBuffers.emplace_back(), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(VirtualTextureInfo), &VirtualTextureInfo);
+
+		//!< [Pass0] ページテーブル、フィードバック (全ページ分を連結する) (Page table, feedback (concatenated for all pages))
+		const std::vector<uint32_t> Zero(Offset, 0);
+		CreateHostVisibleBuffer(StorageBuffers.emplace_back(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, TotalSizeOf(Zero), std::data(Zero));
+		CreateHostVisibleBuffer(StorageBuffers.emplace_back(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, TotalSizeOf(Zero), std::data(Zero));
+	}
+
+	virtual void CreateDisplacementTexture() override {
+		if (!IsVirtualTexture()) {
+			Super::CreateDisplacementTexture();
+			return;
+		}
+
+		//!< 物理ページアトラス (1 フレーム分のステージング付き) [2, 3] (Physical page atlas (with staging for a frame))
+		for (const auto i : GetVirtualTextures()) {
+			auto& Tex = VK::CreateTexture(ToVkFormat(i->GetFormat()), i->GetSlotCountX() * VirtualTexture::SlotSize, i->GetSlotCountY() * VirtualTexture::SlotSize, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+			CreateHostVisibleBuffer(Tex.Staging.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, i->GetSlotBytes() * MaxUploadCount, nullptr);
+		}
+
+		//!< 割り当てられていないスロットを未定義にしないようクリアしておく (Clear so that unassigned slots are not undefined)
+		const auto CB = PrimaryCommandBuffers[0].second[0];
+		constexpr VkCommandBufferBeginInfo CBBI = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.pNext = nullptr,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+			.pInheritanceInfo = nullptr
+		};
+		VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
+			constexpr auto ISR = VkImageSubresourceRange({
+				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+				.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
+				.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+			});
+			const std::array ISRs = { ISR };
+			constexpr auto Color = VkClearColorValue({ .float32 = { 0.0f, 0.0f, 0.0f, 0.0f } });
+			for (size_t i = 0; i < std::size(PipelineStages); ++i) {
+				const auto Image = Textures[2 + i].ImageView.first;
+				ImageMemoryBarrier(CB, Image,
+					VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_2_CLEAR_BIT,
+					VK_ACCESS_2_NONE, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+					VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+				vkCmdClearColorImage(CB, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &Color, static_cast<uint32_t>(std::size(ISRs)), std::data(ISRs));
+				ImageMemoryBarrier(CB, Image,
+					VK_PIPELINE_STAGE_2_CLEAR_BIT, PipelineStages[i],
+					VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT,
+					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			}
+		} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
+		SubmitAndWait(CB);
+	}
+
+	virtual void CreateDescriptor() override {
+		Super::CreateDescriptor();
+		if (!IsVirtualTexture()) { return; }
+
+		//!< [Pass0] 仮想テクスチャ (set = 1) [2] (Virtual texture (set = 1))
+		const auto DS = DescriptorSets.emplace_back(DescriptorSetAllocator.Allocate(DescriptorSetLayouts[2]));
+		const std::array DBIs = {
+			VkDescriptorBufferInfo({.buffer = GetPageTableBuffer().first, .offset = 0, .range = VK_WHOLE_SIZE }),
+			VkDescriptorBufferInfo({.buffer = GetFeedbackBuffer().first, .offset = 0, .range = VK_WHOLE_SIZE }),
+			VkDescriptorBufferInfo({.buffer = GetVirtualTextureBuffer().first, .offset = 0, .range = VK_WHOLE_SIZE }),
+		};
+		const std::array WDSs = {
+			VkWriteDescriptorSet({
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.pNext = nullptr,
+				.dstSet = DS,
+				.dstBinding = 0, .dstArrayElement = 0,
+				.descriptorCount = 2, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+				.pImageInfo = nullptr, .pBufferInfo = &DBIs[0], .pTexelBufferView = nullptr
+			}),
+			VkWriteDescriptorSet({
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.pNext = nullptr,
+				.dstSet = DS,
+				.dstBinding = 2, .dstArrayElement = 0,
+				.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+				.pImageInfo = nullptr, .pBufferInfo = &DBIs[2], .pTexelBufferView = nullptr
+			}),
+		};
+		vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
+	}
+
+	virtual void PopulateFrameGraph(FrameGraph& FG, const int i) override {
+		Super::PopulateFrameGraph(FG, i);
+		if (!IsVirtualTexture()) { return; }
+
+		//!< キルトの描画 (Pass0) でシェーダが書き込んだフィードバックを、フェンスを待った後にホストから読めるようにする
+		//!< (Make feedback written by shaders in quilt rendering (Pass0) readable from host after waiting fence)
+		FG.AddPass("Feedback", [this](const VkCommandBuffer CB) {
+			BufferMemoryBarrier(CB, GetFeedbackBuffer().first,
+				VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_HOST_BIT,
+				VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_ACCESS_2_HOST_READ_BIT);
+		})
+			.Read(FG.Find("Quilt"), VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+			.SideEffect();
+	}
+
+	//!< 要求されたページの転送、ページテーブルは OnUpdate() でホストから直接更新している (Transfer of requested pages, page table is directly updated from host in OnUpdate())
+	virtual bool PopulateTransferCommandBuffer(const VkCommandBuffer CB) override {
+		auto IsRecorded = false;
+		const auto VTs = GetVirtualTextures();
+		for (size_t i = 0; i < std::size(VTs); ++i) {
+			if (std::empty(Uploads[i])) { continue; }
+
+			std::vector<VkBufferImageCopy2> BICs;
+			BICs.reserve(std::size(Uploads[i]));
+			for (size_t j = 0; j < std::size(Uploads[i]); ++j) {
+				BICs.emplace_back(VkBufferImageCopy2({
+					.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
+					.pNext = nullptr,
+					.bufferOffset = j * VTs[i]->GetSlotBytes(), .bufferRowLength = 0, .bufferImageHeight = 0,
+					.imageSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 }),
+					.imageOffset = VTs[i]->GetSlotOffset(Uploads[i][j].Slot),
+					.imageExtent = VkExtent3D({.width = VirtualTexture::SlotSize, .height = VirtualTexture::SlotSize, .depth = 1 }) }));
+			}
+			//!< 他のスロットの内容は保持するので UNDEFINED からは遷移しない (Contents of other slots are kept, so not transitioned from UNDEFINED)
+			const auto Image = Textures[2 + i].ImageView.first;
+			ImageMemoryBarrier(CB, Image,
+				PipelineStages[i], VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+				VK_ACCESS_2_SHADER_READ_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+			const VkCopyBufferToImageInfo2 CBTII2 = {
+				.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2,
+				.pNext = nullptr,
+				.srcBuffer = Textures[2 + i].Staging.back().first, .dstImage = Image,
+				.dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				.regionCount = static_cast<uint32_t>(std::size(BICs)), .pRegions = std::data(BICs)
+			};
+			vkCmdCopyBufferToImage2(CB, &CBTII2);
+			ImageMemoryBarrier(CB, Image,
+				VK_PIPELINE_STAGE_2_TRANSFER_BIT, PipelineStages[i],
+				VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT,
+				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+			Uploads[i].clear();
+			IsRecorded = true;
+		}
+		return IsRecorded;
+	}
+
+	virtual void OnUpdate() override {
+		Super::OnUpdate();
+		if (!IsVirtualTexture()) { return; }
+
+		const auto VTs = GetVirtualTextures();
+
+		//!< 直前のフレームは WaitFence() で完了しているので、フィードバックを読んでクリアする (Previous frame has completed in WaitFence(), so read and clear feedback)
+		{
+			const auto& FB = GetFeedbackBuffer();
+			const std::array MMRs = {
+				VkMappedMemoryRange({
+					.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+					.pNext = nullptr,
+					.memory = FB.second,
+					.offset = 0,
+					.size = VK_WHOLE_SIZE
+				})
+			};
+			void* Data;
+			VERIFY_SUCCEEDED(vkMapMemory(Device, FB.second, 0, VK_WHOLE_SIZE, static_cast<VkMemoryMapFlags>(0), &Data)); {
+				VERIFY_SUCCEEDED(vkInvalidateMappedMemoryRanges(Device, static_cast<uint32_t>(std::size(MMRs)), std::data(MMRs)));
+				auto Feedback = std::span(static_cast<uint32_t*>(Data), GetPageCount());
+				size_t Offset = 0;
+				for (const auto i : VTs) {
+					i->Request(Feedback.subspan(Offset, i->GetPageCount()), FrameCount);
+					Offset += i->GetPageCount();
+				}
+				std::ranges::fill(Feedback, 0);
+				VERIFY_SUCCEEDED(vkFlushMappedMemoryRanges(Device, static_cast<uint32_t>(std::size(MMRs)), std::data(MMRs)));
+			} vkUnmapMemory(Device, FB.second);
+		}
+
+		//!< 割り当てられたページをステージングへ並列にコピーする (Copy assigned pages to staging in parallel)
+		for (size_t i = 0; i < std::size(VTs); ++i) {
+			Uploads[i] = VTs[i]->Update(MaxUploadCount, FrameCount);
+			if (std::empty(Uploads[i])) { continue; }
+
+			const auto& Staging = Textures[2 + i].Staging.back();
+			void* Data;
+			VERIFY_SUCCEEDED(vkMapMemory(Device, Staging.second, 0, VK_WHOLE_SIZE, static_cast<VkMemoryMapFlags>(0), &Data)); {
+				JobSystem::Get().ParallelFor(std::size(Uploads[i]), [&](const size_t j) {
+					VTs[i]->CopyPage(Uploads[i][j].Page, static_cast<std::byte*>(Data) + j * VTs[i]->GetSlotBytes());
+				}, 1);
+				const std::array MMRs = {
+					VkMappedMemoryRange({
+						.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+						.pNext = nullptr,
+						.memory = Staging.second,
+						.offset = 0,
+						.size = VK_WHOLE_SIZE
+					})
+				};
+				VERIFY_SUCCEEDED(vkFlushMappedMemoryRanges(Device, static_cast<uint32_t>(std::size(MMRs)), std::data(MMRs)));
+			} vkUnmapMemory(Device, Staging.second);
+		}
+
+		//!< ページテーブル (Page table)
+		size_t Offset = 0;
+		for (const auto i : VTs) {
+			if (i->ConsumeDirty()) {
+				CopyToHostVisibleMemory(GetPageTableBuffer().second, Offset * sizeof(uint32_t), i->GetPageTable().size_bytes(), std::data(i->GetPageTable()));
+			}
+			Offset += i->GetPageCount();
+		}
+	}
+
+protected:
+	std::array<VirtualTexture*, 2> GetVirtualTextures() { return { &ColorVT, &DisplacementVT }; }
+	uint32_t GetPageCount() const { return ColorVT.GetPageCount() + DisplacementVT.GetPageCount(); }
+
+	BufferAndDeviceMemory& GetVirtualTextureBuffer() { return UniformBuffers[3]; }
+	BufferAndDeviceMemory& GetPageTableBuffer() { return StorageBuffers[0]; }
+	BufferAndDeviceMemory& GetFeedbackBuffer() { return StorageBuffers[1]; }
+
+	//!< アトラスのスロット数、1 フレームで転送するページ数の上限 (Slot count of atlas, max pages transferred in a frame)
+	static constexpr uint32_t AtlasSlots = 16;
+	static constexpr uint32_t MaxUploadCount = 16;
+	//!< カラー、ディスプレースメントを参照するステージ (Stages accessing color, displacement)
+	static constexpr std::array<VkPipelineStageFlags2, 2> PipelineStages = { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT };
+
+	VirtualTexture ColorVT;
+	VirtualTexture DisplacementVT;
+	std::array<std::vector<VirtualTexture::Upload>, 2> Uploads;
+
+	//!< [0] カラー、[1] ディスプレースメント ((幅, 高さ, 最大レベル, ページオフセット), (スロット数 X, Y)) ([0] color, [1] displacement ((width, height, max level, page offset), (slot count X, Y)))
+	struct alignas(16) VIRTUAL_TEXTURE_INFO {
+		glm::ivec4 Info[2];
+		glm::ivec4 Atlas[2];
+	};
+	VIRTUAL_TEXTURE_INFO VirtualTextureInfo;
+};
+
 #ifdef USE_CV
 class DisplacementCVVK : public DisplacementVK
 {
@@ -778,26 +1532,62 @@ private:
 public:
 	DisplacementCVVK() {}
 	DisplacementCVVK(const std::filesystem::path& Color, const std::filesystem::path& Depth) : ColorImagePath(Color), DepthImagePath(Depth) {}
+	//!< 非同期の読み込みがメンバを参照しているので、メンバが破棄される前に完了を待つ (Asynchronous load refers to members, so wait for completion before members are destroyed)
+	virtual ~DisplacementCVVK() { Shutdown(); }
 
 	virtual void CreateDisplacementTexture() override {
 		std::cout << cv::getBuildInformation() << std::endl;
 
-		auto CvColor = cv::imread(std::data(ColorImagePath.string()));
-		cv::cvtColor(CvColor, CvColor, cv::COLOR_BGR2RGBA);
-
-		auto CvDepth = cv::imread(std::data(DepthImagePath.string()));
-		cv::cvtColor(CvDepth, CvDepth, cv::COLOR_BGR2GRAY);
+#ifdef USE_ASYNC_TEXTURE
+		//!< 読み込み完了まではプレースホルダ (灰色、平坦) で表示する (Display with placeholders (gray, flat) until loaded)
+		const auto Index = std::size(Textures);
+		const auto CB = PrimaryCommandBuffers[0].second[0];
+		CreatePlaceholderTexture(CB, VkClearColorValue({ .float32 = { 0.5f, 0.5f, 0.5f, 1.0f } }), VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+		CreatePlaceholderTexture(CB, VkClearColorValue({ .float32 = { 0.0f, 0.0f, 0.0f, 0.0f } }), VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT);
+		//!< 同じ内容のテクスチャが既にあれば共有される (Shared if texture with same contents already exists)
+		const auto ColorKey = GetColorKey(), DepthKey = GetDepthKey();
+		CreateCVTextureAsync(Index, [this, ColorKey] { return LoadColor(ColorKey); }, VK_FORMAT_R8G8B8A8_UNORM, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, IsMipmap(), ColorKey);
+		CreateCVTextureAsync(Index + 1, [this, DepthKey] { return LoadDepth(DepthKey); }, VK_FORMAT_R8_UNORM, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT, false, DepthKey);
+#else
+		//!< カラーとデプスのデコードを並列に行う (Decode color and depth in parallel)
+		size_t ColorKey = 0, DepthKey = 0;
+		cv::Mat CvColor, CvDepth;
+		const std::array Jobs = {
+			JobSystem::Get().Schedule([&] { ColorKey = GetColorKey(); CvColor = LoadColor(ColorKey); }),
+			JobSystem::Get().Schedule([&] { DepthKey = GetDepthKey(); CvDepth = LoadDepth(DepthKey); }),
+		};
+		JobSystem::Get().Wait(Jobs);
 
 		//cv::imshow("Color", CvColor);
 		//cv::imshow("Depth", CvDepth);
 
 		const std::vector Paths = {
-			CvMatAndFormatAndPipelineStage({ CvColor, VK_FORMAT_R8G8B8A8_UNORM, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT }),
-			CvMatAndFormatAndPipelineStage({ CvDepth, VK_FORMAT_R8_UNORM, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT }),
+			CvMatAndFormatAndPipelineStage({ CvColor, VK_FORMAT_R8G8B8A8_UNORM, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, IsMipmap(), ColorKey }),
+			CvMatAndFormatAndPipelineStage({ CvDepth, VK_FORMAT_R8_UNORM, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT, false, DepthKey }),
 		};
 		CreateCVTextures(PrimaryCommandBuffers[0].second[0], Paths);
+#endif
 	}
 protected:
+	//!< キーはキャッシュとイメージの共有の両方に使う (Key is used for both cache and image sharing)
+	size_t GetColorKey() const { return GetTextureCacheKey(HashFile(ColorImagePath), VK_FORMAT_R8G8B8A8_UNORM, VkComponentMapping(), IsMipmap()); }
+	size_t GetDepthKey() const { return GetTextureCacheKey(HashFile(DepthImagePath), VK_FORMAT_R8_UNORM, VkComponentMapping(), false); }
+	//!< 2 回目以降の起動ではデコード、変換済みのものをキャッシュから読み込む (From second launch, decoded and converted one is loaded from cache)
+	cv::Mat LoadColor(const size_t Key) const {
+		return LoadCVTextureCache(Key, [&] {
+			cv::Mat CvColor = cv::imread(std::data(ColorImagePath.string()));
+			cv::cvtColor(CvColor, CvColor, cv::COLOR_BGR2RGBA);
+			return CvColor;
+		});
+	}
+	cv::Mat LoadDepth(const size_t Key) const {
+		return LoadCVTextureCache(Key, [&] {
+			cv::Mat CvDepth = cv::imread(std::data(DepthImagePath.string()));
+			cv::cvtColor(CvDepth, CvDepth, cv::COLOR_BGR2GRAY);
+			return CvDepth;
+		});
+	}
+
 	std::filesystem::path ColorImagePath = std::filesystem::path("..") / ".." / "Assets" / "Bricks091_1K-JPG_Color.jpg";
 	std::filesystem::path DepthImagePath = std::filesystem::path("..") / ".." / "Assets" / "Bricks091_1K-JPG_Displacement.jpg";
 };
@@ -813,23 +1603,37 @@ public:
 	virtual void CreateDisplacementTexture() override {
 		std::cout << cv::getBuildInformation() << std::endl;
 
-		auto CvRGBD = cv::imread(std::data(ImagePath.string()));
-		const auto Cols = CvRGBD.cols / 2;
-
-		auto CvColor = cv::Mat(CvRGBD, cv::Rect(0, 0, Cols, CvRGBD.rows));
-		cv::cvtColor(CvColor, CvColor, cv::COLOR_BGR2RGBA);
-
-		auto CvDepth = cv::Mat(CvRGBD, cv::Rect(Cols, 0, Cols, CvRGBD.rows));
-		cv::cvtColor(CvDepth, CvDepth, cv::COLOR_BGR2GRAY);
+		//!< 同じ RGBD イメージの左右なので、ソースのハッシュは共有し Variant で区別する (Left and right of same RGBD image, so share source hash and distinguish by Variant)
+		const auto Hash = HashFile(ImagePath);
+		const auto ColorKey = GetTextureCacheKey(Hash, VK_FORMAT_R8G8B8A8_UNORM, VkComponentMapping(), IsMipmap(), 0);
+		const auto DepthKey = GetTextureCacheKey(Hash, VK_FORMAT_R8_UNORM, VkComponentMapping(), false, 1);
+
+		//!< 両方キャッシュにあればデコードしない (Not decoded if both are in cache)
+		cv::Mat CvRGBD;
+		const auto Decode = [&](const int Index) {
+			if (CvRGBD.empty()) { CvRGBD = cv::imread(std::data(ImagePath.string())); }
+			const auto Cols = CvRGBD.cols / 2;
+			return cv::Mat(CvRGBD, cv::Rect(Cols * Index, 0, Cols, CvRGBD.rows));
+		};
+		const auto CvColor = LoadCVTextureCache(ColorKey, [&] {
+			cv::Mat CvColor;
+			cv::cvtColor(Decode(0), CvColor, cv::COLOR_BGR2RGBA);
+			return CvColor;
+		});
+		const auto CvDepth = LoadCVTextureCache(DepthKey, [&] {
+			cv::Mat CvDepth;
+			cv::cvtColor(Decode(1), CvDepth, cv::COLOR_BGR2GRAY);
+			return CvDepth;
+		});
 
 		const std::vector Paths = {
-			CvMatAndFormatAndPipelineStage({ CvColor, VK_FORMAT_R8G8B8A8_UNORM, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT }),
-			CvMatAndFormatAndPipelineStage({ CvDepth, VK_FORMAT_R8_UNORM, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT }),
+			CvMatAndFormatAndPipelineStage({ CvColor, VK_FORMAT_R8G8B8A8_UNORM, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, IsMipmap(), ColorKey }),
+			CvMatAndFormatAndPipelineStage({ CvDepth, VK_FORMAT_R8_UNORM, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT, false, DepthKey }),
 		};
 		CreateCVTextures(PrimaryCommandBuffers[0].second[0], Paths);
 	}
 protected:
-	//!< RBGD C[W (RGBD image)
+	//!< RBGD イメージ (RGBD image)
 	std::filesystem::path ImagePath = std::filesystem::path("..") / ".." / "Assets" / "Bricks076C_1K.png";
 };
 #endif
@@ -840,36 +1644,169 @@ private:
 	using Super = DisplacementVK;
 public:
 	virtual void CreateDisplacementTexture() override {
-		//!< Aj[VeNX`}bv (Xe[WOobt@t) [2, 3]
-		const auto Size = sizeof(uint32_t) * GetWidth() * GetHeight();
-		for (auto i = 0; i < 2; ++i) {
-			VK::CreateTexture(VK_FORMAT_B8G8R8A8_UNORM, GetWidth(), GetHeight(), VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
-			CreateHostVisibleBuffer(Textures.back().Staging.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, Size, nullptr);
+		if (IsGPUGeneration()) {
+			//!< アニメーションテクスチャマップ [2, 3]、コンピュートシェーダから直接書き込むのでステージングは不要
+			//!< (Animated texture maps, written directly from compute shader, so no staging)
+			for (auto i = 0; i < 2; ++i) {
+				VK::CreateTexture(VK_FORMAT_R8G8B8A8_UNORM, GetWidth(), GetHeight(), VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+			}
 		}
+		else {
+			//!< アニメーションテクスチャマップ (フレーム毎のステージングのリング付き) [2, 3]
+			const auto Size = sizeof(uint32_t) * GetWidth() * GetHeight();
+			for (auto i = 0; i < 2; ++i) {
+				VK::CreateTexture(VK_FORMAT_B8G8R8A8_UNORM, GetWidth(), GetHeight(), VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+				for (uint32_t j = 0; j < StagingRingSize; ++j) {
+					CreateHostVisibleBuffer(Textures.back().Staging.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, Size, nullptr);
+				}
+			}
+			//!< パターンは毎フレーム確保せずに使い回す (Pattern is reused instead of allocated every frame)
+			Pattern.resize(GetWidth() * GetHeight());
+		}
+	}
+	virtual void CreatePipelineLayout() override {
+		Super::CreatePipelineLayout();
+		if (!IsGPUGeneration()) { return; }
+
+		//!< [Compute] 書き込み先 (Destination) DescriptorSetLayouts[2], PipelineLayouts[2]
+		VK::CreatePipelineLayout({
+			CreateDescriptorSetLayout({
+				//!< [0](SI) Color
+				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .pImmutableSamplers = nullptr }),
+				//!< [1](SI) Displacement
+				VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .pImmutableSamplers = nullptr }),
+			}),
+		}, {
+			VkPushConstantRange({.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(PATTERN) }),
+		});
+	}
+	virtual void CreatePipeline_Compute(std::vector<VkPipeline>& PLs) override {
+		if (!IsGPUGeneration()) { return; }
+
+		const auto SM = CreateShaderModule(GetShaderDirectory() / "Pattern.comp.spv", EMBEDDED_SPIRV(Pattern_comp));
+		VK::CreatePipeline_Compute(PLs.emplace_back(), SM, PipelineLayouts[2]);
+		vkDestroyShaderModule(Device, SM, nullptr);
 	}
-	virtual void PopulatePrimaryCommandBuffer_Update(const int i) override {
-		if (0 == i) {
-			const auto CB = PrimaryCommandBuffers[0].second[i];
+	virtual void CreateDescriptor() override {
+		Super::CreateDescriptor();
+		if (!IsGPUGeneration()) { return; }
 
-			//!< (Xe[WO) eNX`XVR}h
-			PopulateCopyCommand(CB, Textures[2].Staging.back().first, Textures[2].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
-			PopulateCopyCommand(CB, Textures[3].Staging.back().first, Textures[3].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT);
+		PatternDescriptorSet = DescriptorSetAllocator.Allocate(DescriptorSetLayouts[2]);
+		const std::array DIIs = {
+			VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = Textures[2].ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_GENERAL }),
+			VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = Textures[3].ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_GENERAL }),
+		};
+		const std::array WDSs = {
+			VkWriteDescriptorSet({
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.pNext = nullptr,
+				.dstSet = PatternDescriptorSet,
+				.dstBinding = 0, .dstArrayElement = 0,
+				.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+				.pImageInfo = &DIIs[0], .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+			}),
+			VkWriteDescriptorSet({
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.pNext = nullptr,
+				.dstSet = PatternDescriptorSet,
+				.dstBinding = 1, .dstArrayElement = 0,
+				.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+				.pImageInfo = &DIIs[1], .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+			}),
+		};
+		vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
+	}
+	//!< 事前に記録したパスのコマンドバッファではなく、フレーム毎の転送コマンドバッファで更新する (どのスワップチェインイメージでも反映される)
+	//!< (Updated with per frame transfer command buffer instead of pre recorded pass command buffers (reflected for any swapchain image))
+	virtual bool PopulateTransferCommandBuffer(const VkCommandBuffer CB) override {
+		if (!std::exchange(IsStagingUpdated, false)) { return false; }
+
+		if (IsGPUGeneration()) {
+			//!< コンピュートシェーダでパターンを生成し、テクスチャへ直接書き込む (Generate pattern with compute shader, write directly into textures)
+			constexpr std::array PSFs = { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT };
+			//!< 全体を書き換えるので以前の内容は破棄してよい (Whole image is overwritten, so previous contents can be discarded)
+			for (size_t i = 0; i < std::size(PSFs); ++i) {
+				ImageMemoryBarrier(CB, Textures[2 + i].ImageView.first,
+					PSFs[i], VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+					VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+					VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+			}
+
+			vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_COMPUTE, Pipelines[2]);
+			const std::array DSs = { PatternDescriptorSet };
+			vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_COMPUTE, PipelineLayouts[2], 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), 0, nullptr);
+			const auto PC = PATTERN({ .Seed = GetFrameSeed() });
+			vkCmdPushConstants(CB, PipelineLayouts[2], VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PC), &PC);
+			vkCmdDispatch(CB, (GetWidth() + 7) / 8, (GetHeight() + 7) / 8, 1);
+
+			for (size_t i = 0; i < std::size(PSFs); ++i) {
+				ImageMemoryBarrier(CB, Textures[2 + i].ImageView.first,
+					VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, PSFs[i],
+					VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+					VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			}
 		}
+		else {
+			//!< (ステージングから) テクスチャ更新コマンド
+			const auto Index = GetStagingIndex();
+			PopulateCopyCommand(CB, Textures[2].Staging[Index].first, Textures[2].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+			PopulateCopyCommand(CB, Textures[3].Staging[Index].first, Textures[3].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT);
+		}
+		return true;
 	}
 
 	virtual void OnUpdate() override {
 		Super::OnUpdate();
 
-		//!< (eNX`) Xe[WOXV
-		std::vector<uint32_t> Pattern(GetWidth() * GetHeight());
-		std::random_device RndDev;
-		std::ranges::generate(Pattern, [&]() { return RndDev(); });
-		CopyToHostVisibleMemory(Textures[2].Staging.back().second, 0, TotalSizeOf(Pattern), std::data(Pattern));
-		CopyToHostVisibleMemory(Textures[3].Staging.back().second, 0, TotalSizeOf(Pattern), std::data(Pattern));
+		//!< GPU で生成する場合は転送コマンドバッファで行うので、ここでは何もしない (In case generated on GPU, done in transfer command buffer, nothing to do here)
+		if (!IsGPUGeneration()) {
+			//!< (テクスチャの) ステージングを更新
+			//!< 画素の値は画素の位置とシードのみから決まる (カウンタベース) ので、行は並列に、行内はベクトル化して生成できる
+			//!< (Pixel value depends only on pixel position and seed (counter based), so rows are generated in parallel and vectorized within a row)
+			const auto Base = Pcg(GetFrameSeed());
+			const auto Width = GetWidth();
+			JobSystem::Get().ParallelFor(GetHeight(), [&](const size_t Row) {
+				const auto First = static_cast<uint32_t>(Row * Width);
+				const auto Data = std::data(Pattern) + First;
+				for (uint32_t i = 0; i < Width; ++i) {
+					Data[i] = Pcg(First + i + Base);
+				}
+			});
+			CopyToHostVisibleMemory(Textures[2].Staging[GetStagingIndex()].second, 0, TotalSizeOf(Pattern), std::data(Pattern));
+			CopyToHostVisibleMemory(Textures[3].Staging[GetStagingIndex()].second, 0, TotalSizeOf(Pattern), std::data(Pattern));
+		}
+		IsStagingUpdated = true;
 	}
 protected:
 	virtual uint32_t GetWidth() const { return 320; }
 	virtual uint32_t GetHeight() const { return 240; }
+
+	//!< ステージングのリング、処理中のフレーム数分を持ち、ホストは GPU が転送中のものとは別のステージングへ書き込む
+	//!< 現状は OnUpdate() の前にフェンスを待つので 1 つで足りる、FramesInFlight を増やした場合もそのまま競合しない
+	//!< (Staging ring, one per frame in flight, host writes into staging other than the one GPU is transferring from.
+	//!< Currently fence is waited before OnUpdate(), so one is enough, still race free if FramesInFlight is increased)
+	static constexpr uint32_t StagingRingSize = FramesInFlight;
+	uint32_t GetStagingIndex() const { return FrameCount % StagingRingSize; }
+	//!< このフレームでステージングが更新されたら転送する、初回はレイアウト遷移の為に転送する
+	//!< (Transferred if staging has been updated in this frame, transferred at first for layout transition)
+	bool IsStagingUpdated = true;
+
+	//!< デバイスがストレージイメージをサポートしていれば、パターンは GPU で生成する (If device supports storage image, pattern is generated on GPU)
+	virtual bool IsGPUGeneration() const { return IsSupportedFormat(VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT); }
+	//!< PCG ハッシュ、Pattern.comp と同じ (PCG hash, same as Pattern.comp)
+	static constexpr uint32_t Pcg(const uint32_t Value) {
+		const auto State = Value * 747796405u + 2891336453u;
+		const auto Word = ((State >> ((State >> 28u) + 4u)) ^ State) * 277803737u;
+		return (Word >> 22u) ^ Word;
+	}
+	//!< 起動毎に異なるシードにフレーム数を加えたもの (Seed differs per launch, plus frame count)
+	uint32_t GetFrameSeed() const { return Seed + static_cast<uint32_t>(FrameCount); }
+	const uint32_t Seed = std::random_device()();
+	std::vector<uint32_t> Pattern;
+	struct PATTERN {
+		uint32_t Seed;
+	};
+	VkDescriptorSet PatternDescriptorSet = VK_NULL_HANDLE;
 };
 
 #ifdef USE_CV
@@ -882,34 +1819,173 @@ public:
 	VideoDisplacementVK(const std::filesystem::path& RGBD) : VideoPath(RGBD) {}
 
 	virtual void CreateDisplacementTexture() override {
-		Super::CreateDisplacementTexture();
-
 		Capture.open(std::data(VideoPath.string()));
+
+		if (IsGPUConversion()) {
+			//!< テクスチャマップ [2, 3]、コンピュートシェーダから書き込む (Texture maps, written from compute shader)
+			for (auto i = 0; i < 2; ++i) {
+				VK::CreateTexture(VK_FORMAT_R8G8B8A8_UNORM, GetWidth(), GetHeight(), VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+			}
+			//!< ステージングはデコードされたままのフレーム (ストレージバッファとしてシェーダから読む) (Staging is frame as decoded (read from shader as storage buffer))
+			FrameSize = cv::Size(static_cast<int>(Capture.get(cv::CAP_PROP_FRAME_WIDTH)), static_cast<int>(Capture.get(cv::CAP_PROP_FRAME_HEIGHT)));
+			FrameFormat = RequestNativeFrameFormat();
+			//!< リングの各要素は 1 つのバッファ内に並べ、先頭はプッシュ定数で指定する (Elements of ring are laid out in a buffer, base is specified with push constant)
+			const auto Size = static_cast<size_t>(GetFramePitch()) * GetFrameRows();
+			FrameBytes = (std::max)((Size + 3) & ~size_t(3), size_t(4));
+			CreateHostVisibleBuffer(Textures[2].Staging.emplace_back(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, FrameBytes * StagingRingSize, nullptr);
+		}
+		else {
+			//!< テクスチャマップ [2, 3]、ステージングは左右 (カラー、深度) を並べたフレーム全体で共有する
+			//!< (Texture maps, staging is shared as a whole frame with left and right (color, depth) side by side)
+			for (auto i = 0; i < 2; ++i) {
+				VK::CreateTexture(VK_FORMAT_B8G8R8A8_UNORM, GetWidth(), GetHeight(), VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+			}
+			for (uint32_t i = 0; i < StagingRingSize; ++i) {
+				CreateHostVisibleBuffer(Textures[2].Staging.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, sizeof(uint32_t) * (GetWidth() << 1) * GetHeight(), nullptr);
+			}
+		}
+
+		//!< デコードは専用スレッドで行う、以降 Capture はデコードスレッドからのみ触る (Decode on dedicated thread, Capture is touched only from decode thread afterwards)
+		DecodeThread = std::jthread([this, IsGPU = IsGPUConversion()](std::stop_token Token) { Decode(Token, IsGPU); });
 	}
+	virtual void CreatePipelineLayout() override {
+		Super::CreatePipelineLayout();
+		if (!IsGPUConversion()) { return; }
 
-	virtual void OnUpdate() override {
-		Super::OnUpdate();
+		//!< [Compute] フレーム、書き込み先 (Frame, destination) DescriptorSetLayouts[2], PipelineLayouts[2]
+		VK::CreatePipelineLayout({
+			CreateDescriptorSetLayout({
+				//!< [0](SB) Frame
+				VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .pImmutableSamplers = nullptr }),
+				//!< [1](SI) Dst
+				VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .pImmutableSamplers = nullptr }),
+			}),
+		}, {
+			VkPushConstantRange({.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(CONVERT) }),
+		});
+	}
+	virtual void CreatePipeline_Compute(std::vector<VkPipeline>& PLs) override {
+		if (!IsGPUConversion()) { return; }
 
-		cv::Mat CvFrame;
+		const auto SM = CreateShaderModule(GetShaderDirectory() / "Convert.comp.spv", EMBEDDED_SPIRV(Convert_comp));
+		VK::CreatePipeline_Compute(PLs.emplace_back(), SM, PipelineLayouts[2]);
+		vkDestroyShaderModule(Device, SM, nullptr);
+	}
+	virtual void CreateDescriptor() override {
+		Super::CreateDescriptor();
+		if (!IsGPUConversion()) { return; }
+
+		//!< 左右 (カラー、深度) で書き込み先のみが異なる (Only destination differs between left and right (color, depth))
+		const auto DBI = VkDescriptorBufferInfo({.buffer = Textures[2].Staging.back().first, .offset = 0, .range = VK_WHOLE_SIZE });
+		for (size_t i = 0; i < std::size(ConvertDescriptorSets); ++i) {
+			ConvertDescriptorSets[i] = DescriptorSetAllocator.Allocate(DescriptorSetLayouts[2]);
+			const auto DII = VkDescriptorImageInfo({.sampler = VK_NULL_HANDLE, .imageView = Textures[2 + i].ImageView.second, .imageLayout = VK_IMAGE_LAYOUT_GENERAL });
+			const std::array WDSs = {
+				VkWriteDescriptorSet({
+					.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+					.pNext = nullptr,
+					.dstSet = ConvertDescriptorSets[i],
+					.dstBinding = 0, .dstArrayElement = 0,
+					.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+					.pImageInfo = nullptr, .pBufferInfo = &DBI, .pTexelBufferView = nullptr
+				}),
+				VkWriteDescriptorSet({
+					.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+					.pNext = nullptr,
+					.dstSet = ConvertDescriptorSets[i],
+					.dstBinding = 1, .dstArrayElement = 0,
+					.descriptorCount = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+					.pImageInfo = &DII, .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+				}),
+			};
+			vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
+		}
+	}
+	//!< 新しいフレームが来た時のみ、フレーム毎の転送コマンドバッファで更新する (Updated with per frame transfer command buffer, only when new frame has arrived)
+	virtual bool PopulateTransferCommandBuffer(const VkCommandBuffer CB) override {
+		if (!std::exchange(IsStagingUpdated, false)) { return false; }
+
+		const auto Index = GetStagingIndex();
+		if (IsGPUConversion()) {
+			//!< 左右の半分をフレームからそのまま読み、変換、縮小して書き込む (Read left and right halves straight from frame, convert, resize and write)
+			vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_COMPUTE, Pipelines[2]);
+			const auto Cols = FrameSize.width >> 1;
+			constexpr std::array PSFs = { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT };
+			for (size_t j = 0; j < std::size(ConvertDescriptorSets); ++j) {
+				const auto Image = Textures[2 + j].ImageView.first;
+				//!< 全体を書き換えるので以前の内容は破棄してよい (Whole image is overwritten, so previous contents can be discarded)
+				ImageMemoryBarrier(CB, Image,
+					PSFs[j], VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+					VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+					VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+
+				const std::array DSs = { ConvertDescriptorSets[j] };
+				vkCmdBindDescriptorSets(CB, VK_PIPELINE_BIND_POINT_COMPUTE, PipelineLayouts[2], 0, static_cast<uint32_t>(std::size(DSs)), std::data(DSs), 0, nullptr);
+				const auto PC = CONVERT({
+					.Offset = glm::ivec2(Cols * static_cast<int>(j), 0), .Size = glm::ivec2(Cols, FrameSize.height),
+					.Base = static_cast<int32_t>(FrameBytes * Index),
+					.Pitch = GetFramePitch(), .Height = FrameSize.height,
+					.Format = static_cast<int32_t>(FrameFormat)
+				});
+				vkCmdPushConstants(CB, PipelineLayouts[2], VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PC), &PC);
+				vkCmdDispatch(CB, (GetWidth() + 7) / 8, (GetHeight() + 7) / 8, 1);
 
-		Capture >> CvFrame;
-		cv::resize(CvFrame, CvFrame, cv::Size(CvSize.width << 1, CvSize.height));
+				ImageMemoryBarrier(CB, Image,
+					VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, PSFs[j],
+					VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+					VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+			}
+		}
+		else {
+			//!< 左右の半分をフレームからそのまま転送する (Left and right halves are uploaded straight from the frame)
+			const auto Staging = Textures[2].Staging[Index].first;
+			const auto RowLength = GetWidth() << 1;
+			PopulateCopyCommand(CB, Staging, Textures[2].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, 0, RowLength);
+			PopulateCopyCommand(CB, Staging, Textures[3].ImageView.first, GetWidth(), GetHeight(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT, sizeof(uint32_t) * GetWidth(), RowLength);
+		}
+		return true;
+	}
 
-		const auto Cols = CvFrame.cols >> 1;
-		auto CvColor = cv::Mat(CvFrame, cv::Rect(0, 0, Cols, CvFrame.rows));
-		cv::cvtColor(CvColor, CvColor, cv::COLOR_RGB2RGBA);
+	virtual void OnUpdate() override {
+		//!< 乱数パターンは不要なので AnimatedDisplacementVK::OnUpdate() は呼ばない (Random pattern is not needed, so AnimatedDisplacementVK::OnUpdate() is not called)
+		DisplacementVK::OnUpdate();
 
-		auto CvDepth = cv::Mat(CvFrame, cv::Rect(Cols, 0, Cols, CvFrame.rows));
-		cv::cvtColor(CvDepth, CvDepth, cv::COLOR_RGB2RGBA);
+		const auto Front = Frames.Peek();
+		if (nullptr == Front) { return; }
+
+		//!< 最初のフレームを受け取った時点を再生開始とする (Playback starts when first frame is received)
+		const auto Now = std::chrono::steady_clock::now();
+		if (!IsPlaying) {
+			PlaybackStart = Now - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(Front->PTS));
+			IsPlaying = true;
+		}
+		const auto Time = std::chrono::duration<double, std::milli>(Now - PlaybackStart).count();
+
+		//!< 表示時刻までに間に合ったフレームのうち最新のものを使い、古いものは捨てる、無ければ前のフレームのまま
+		//!< (Use newest frame ready by display time and drop older ones, if none keep previous frame)
+		for (auto Next = Frames.Peek(1); nullptr != Next && Next->PTS <= Time; Next = Frames.Peek(1)) {
+			Frames.Pop();
+		}
+		const auto Frame = Frames.Peek();
+		if (Frame->PTS > Time) { return; }
 
 #if true
-		//!< vr[
-		cv::imshow("Frame", CvFrame);
+		//!< プレビュー、GPU で変換する場合はデコーダのネイティブ形式 (NV12 等) のままで表示できず、毎フレームのコストにもなるので行わない
+		//!< (Preview, not done when converting on GPU, as it is still decoder's native format (NV12 etc.) and would cost every frame)
+		if (!IsGPUConversion()) {
+			cv::imshow("Frame", Frame->Mat);
+		}
 #endif
 
-		//!< (eNX`) Xe[WOXV
-		CopyToHostVisibleMemory(Textures[2].Staging.back().second, 0, CvColor.total() * CvColor.elemSize(), CvColor.ptr());
-		CopyToHostVisibleMemory(Textures[3].Staging.back().second, 0, CvDepth.total() * CvDepth.elemSize(), CvDepth.ptr());
+		//!< (テクスチャの) ステージングを更新
+		if (IsGPUConversion()) {
+			CopyToHostVisibleMemory(Textures[2].Staging.back().second, FrameBytes * GetStagingIndex(), Frame->Mat);
+		}
+		else {
+			CopyToHostVisibleMemory(Textures[2].Staging[GetStagingIndex()].second, 0, Frame->Mat);
+		}
+		IsStagingUpdated = true;
+		Frames.Pop();
 	}
 protected:
 	virtual uint32_t GetWidth() const override { return CvSize.width; }
@@ -920,10 +1996,101 @@ protected:
 	//	WorldBuffer = glm::scale(glm::mat4(1.0f), glm::vec3(X, Y, Z));
 	//}
 
-	//!< RGBD rfI (RGBD video)
+	//!< RGBD ビデオ (RGBD video)
 	std::filesystem::path VideoPath = std::filesystem::path("..") / ".." / "Assets" / "christmas2020-Record3D.mp4";
 	cv::Size CvSize = cv::Size(1440, 2560) / 4;
 	cv::VideoCapture Capture;
+
+	//!< [デコードスレッド] リングに空きがあればデコードして積む、GPU で変換しない場合は変換も行う
+	//!< (Decode thread, decode and push if ring has space, also convert if not converted on GPU)
+	void Decode(std::stop_token Token, const bool IsGPU) {
+		const auto Fps = Capture.get(cv::CAP_PROP_FPS);
+		cv::Mat CvFrame;
+		for (uint64_t Index = 0; !Token.stop_requested(); ) {
+			const auto Frame = Frames.BeginPush();
+			if (nullptr == Frame) {
+				//!< 消費されるまで待つ (Wait until consumed)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				continue;
+			}
+			//!< GPU で変換する場合はデコードされたまま、要素の cv::Mat は再利用される (In case converted on GPU, as decoded, cv::Mat of element is reused)
+			if (!Capture.read(IsGPU ? Frame->Mat : CvFrame)) { break; }
+			if (IsGPU) {
+				if (Frame->Mat.cols != FrameSize.width || Frame->Mat.rows != GetFrameRows() || static_cast<int>(Frame->Mat.cols * Frame->Mat.elemSize()) != GetFramePitch()) { continue; }
+			}
+			else {
+				cv::resize(CvFrame, CvFrame, cv::Size(CvSize.width << 1, CvSize.height));
+				//!< 左右ごとに ROI を変換すると新たに確保されるので、フレーム全体を 1 回で変換する (Converting each ROI allocates anew, so convert whole frame at once)
+				cv::cvtColor(CvFrame, Frame->Mat, cv::COLOR_RGB2RGBA);
+			}
+			//!< バックエンドによっては位置 (ミリ秒) が取れないので、その場合はフレームレートから求める (Some backends do not report position (msec), compute from frame rate then)
+			Frame->PTS = Capture.get(cv::CAP_PROP_POS_MSEC);
+			if (0 < Index && 0.0 >= Frame->PTS && 0.0 < Fps) { Frame->PTS = Index * 1000.0 / Fps; }
+			++Index;
+			Frames.EndPush();
+		}
+	}
+	//!< 表示時刻 (ミリ秒) 付きのフレーム (Frame with presentation time (msec))
+	struct FRAME {
+		cv::Mat Mat;
+		double PTS = 0.0;
+	};
+	SPSCRing<FRAME, 4> Frames;
+	std::chrono::steady_clock::time_point PlaybackStart;
+	bool IsPlaying = false;
+
+	//!< 乱数パターンは生成しない (Random pattern is not generated)
+	virtual bool IsGPUGeneration() const override { return false; }
+	//!< デバイスがストレージイメージをサポートしていれば、色変換、縮小は GPU で行う (If device supports storage image, color conversion and resize are done on GPU)
+	bool IsGPUConversion() const { return IsSupportedFormat(VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT); }
+	//!< デコーダが出力するフレームのフォーマット、NV12 は Y プレーンの後に CbCr がインターリーブされたプレーンが続く
+	//!< (Format of frame decoder outputs, NV12 is Y plane followed by interleaved CbCr plane)
+	enum class FRAME_FORMAT : int32_t {
+		BGR,
+		GRAY,
+		NV12,
+	};
+	FRAME_FORMAT FrameFormat = FRAME_FORMAT::BGR;
+	int32_t GetFramePitch() const { return FrameSize.width * (FRAME_FORMAT::BGR == FrameFormat ? 3 : 1); }
+	int32_t GetFrameRows() const { return FRAME_FORMAT::NV12 == FrameFormat ? FrameSize.height * 3 / 2 : FrameSize.height; }
+	//!< RGB への変換を止めてデコーダのネイティブフォーマットを要求し、最初のフレームから判別して先頭へ戻す、判別できない場合は従来通り BGR へ変換させる
+	//!< (Stop conversion to RGB to request decoder's native format, detect from first frame and rewind, let it convert to BGR as before if not detectable)
+	FRAME_FORMAT RequestNativeFrameFormat() {
+		if (Capture.set(cv::CAP_PROP_CONVERT_RGB, 0)) {
+			cv::Mat CvFrame;
+			if (Capture.read(CvFrame) && Capture.set(cv::CAP_PROP_POS_FRAMES, 0) && CvFrame.cols == FrameSize.width) {
+				switch (CvFrame.type()) {
+				case CV_8UC3:
+					if (CvFrame.rows == FrameSize.height) { return FRAME_FORMAT::BGR; }
+					break;
+				case CV_8UC1:
+					//!< NV12 は Y (高さ分) の後に CbCr (高さの半分) が続く (NV12 is Y (height) followed by CbCr (half height))
+					if (CvFrame.rows == FrameSize.height) { return FRAME_FORMAT::GRAY; }
+					if (CvFrame.rows == FrameSize.height * 3 / 2) { return FRAME_FORMAT::NV12; }
+					break;
+				default:
+					break;
+				}
+			}
+			Capture.set(cv::CAP_PROP_CONVERT_RGB, 1);
+		}
+		Capture.set(cv::CAP_PROP_POS_FRAMES, 0);
+		return FRAME_FORMAT::BGR;
+	}
+	cv::Size FrameSize;
+	size_t FrameBytes = 0;
+	struct CONVERT {
+		glm::ivec2 Offset;
+		glm::ivec2 Size;
+		int32_t Base;
+		int32_t Pitch;
+		int32_t Height;
+		int32_t Format;
+	};
+	std::array<VkDescriptorSet, 2> ConvertDescriptorSets;
+
+	//!< 最後に宣言し、他のメンバより先に停止、合流させる (Declared last, so stopped and joined before other members)
+	std::jthread DecodeThread;
 };
 
 #ifdef USE_HAILO
@@ -945,25 +2112,25 @@ public:
 				if (CM.empty() || DM.empty()) { return false; }
 				
 #if true
-				//!< vr[
+				//!< プレビュー
 				{
 					cv::Mat L, R, LR;
 					const auto CvSize = cv::Size(320, 240);
 
-					//!<  : J[}bv
+					//!< 左 : カラーマップ
 					cv::resize(CM, L, CvSize, cv::INTER_AREA);
 
-					//!< E : [x}bv (AI ̏o͂ʃXbhŐ[x}bv։HĂ̂ŁAbNKv)
+					//!< 右 : 深度マップ (AI の出力を別スレッドで深度マップへ加工しているので、ロックする必要がある)
 					{
 						std::lock_guard Lock(DepthEstimation::GetMutex());
 
 						cv::resize(DM, R, CvSize, cv::INTER_AREA);
 					}
 
-					//!< AׂɍẼ^Cv 8UC3 ɍ킹Kv
+					//!< 連結する為に左右のタイプを 8UC3 に合わせる必要がある
 					cv::cvtColor(R, R, cv::COLOR_GRAY2BGR);
 					R.convertTo(R, CV_8UC3);
-					//!< A
+					//!< 水平連結
 					cv::hconcat(L, R, LR);
 
 					cv::imshow("LR", LR);
@@ -973,19 +2140,24 @@ public:
 			});
 	}
 	virtual void OnUpdate() override {
-		Super::OnUpdate();
+		//!< 乱数パターンは不要なので AnimatedDisplacementVK::OnUpdate() は呼ばない (Random pattern is not needed, so AnimatedDisplacementVK::OnUpdate() is not called)
+		DisplacementVK::OnUpdate();
 
-		//!< (eNX`) Xe[WOXV
+		//!< (テクスチャの) ステージングを更新
 		const auto& CvColor = DepthEstimation::GetColorMap();
 		const auto& CvDepth = DepthEstimation::GetDepthMap();
 		if (!CvColor.empty() && !CvDepth.empty()) {
 			std::lock_guard Lock(GetMutex());
 
-			CopyToHostVisibleMemory(Textures[2].Staging.back().second, 0, CvColor.total() * CvColor.elemSize(), CvColor.ptr());
-			CopyToHostVisibleMemory(Textures[3].Staging.back().second, 0, CvDepth.total() * CvDepth.elemSize(), CvDepth.ptr());
+			CopyToHostVisibleMemory(Textures[2].Staging[GetStagingIndex()].second, 0, CvColor);
+			CopyToHostVisibleMemory(Textures[3].Staging[GetStagingIndex()].second, 0, CvDepth);
+			IsStagingUpdated = true;
 		}
 	}
 protected:
+	//!< 推論結果をステージング経由で転送するので、乱数パターンは生成しない (Inference results are uploaded via staging, so random pattern is not generated)
+	virtual bool IsGPUGeneration() const override { return false; }
+
 	std::filesystem::path VideoPath = std::filesystem::path("..") / ".." / "Assets" / "instance_segmentation.mp4";
 };
 #endif //!< USE_HAILO
@@ -16,10 +16,10 @@
 #pragma comment(lib, "glfw3dll.lib")
 #endif
 
-//#define USE_BORDERLESS	//!< {[_[X
-#define USE_EXTFULLSCREEN //!< gj^AtXN[
+//#define USE_BORDERLESS	//!< ボーダーレス
+#define USE_EXTFULLSCREEN //!< 拡張モニタ、フルスクリーン
 
-//!< R[obN (Callbacks)
+//!< コールバック (Callbacks)
 static void GlfwErrorCallback(int Code, const char* Description)
 {
 	std::cerr << "[Glfw] ErrorCallback Code = " << Code << ", Description = " << Description << std::endl;
@@ -41,9 +41,9 @@ class Glfw
 public:
 	Glfw(GLFWwindow* Win) : GlfwWindow(Win) {
 		uint32_t Count = 0;
-		//!< glfwGetRequiredInstanceExtensions vbgtH[̈ႢzĂ
+		//!< glfwGetRequiredInstanceExtensions がプラットフォーム毎の違いを吸収してくれる
 		const auto Ptr = glfwGetRequiredInstanceExtensions(&Count);
-		//!< u|C^ + v span Ŏ󂯂
+		//!< 「ポインタ + 個数」を span で受ける
 		const auto Span = std::span(Ptr, Count);
 		InstanceExtensions.assign(std::begin(Span), std::end(Span));
 		for (auto& i : InstanceExtensions) {
@@ -84,6 +84,31 @@ public:
 	}
 };
 
+class VirtualDisplacementGlfwVK : public VirtualDisplacementVK, public Glfw
+{
+private:
+	using Super = VirtualDisplacementVK;
+public:
+	VirtualDisplacementGlfwVK(GLFWwindow* Win) : Glfw(Win) {}
+	VirtualDisplacementGlfwVK(GLFWwindow* Win, const std::filesystem::path& Color, const std::filesystem::path& Depth) : Super(Color, Depth), Glfw(Win) {}
+
+	virtual void CreateInstance() override {
+		Super::CreateInstance(InstanceExtensions);
+		LOG();
+	}
+	virtual void CreateSurface() override {
+		VERIFY_SUCCEEDED(glfwCreateWindowSurface(Instance, GlfwWindow, nullptr, &Surface));
+		LOG();
+	}
+	virtual bool CreateSwapchain() override {
+		if (Super::CreateSwapchain(static_cast<uint32_t>(FBWidth), static_cast<uint32_t>(FBHeight))) {
+			LOG();
+			return true;
+		}
+		return false;
+	}
+};
+
 #ifdef USE_CV
 class DisplacementCVGlfwVK : public DisplacementCVVK, public Glfw
 {
@@ -215,20 +240,20 @@ public:
 
 int main()
 {
-	//!<  (Initialize)
+	//!< 初期化 (Initialize)
 	if (!glfwInit()) {
 		std::cerr << "glfwInit() failed" << std::endl;
 		exit(EXIT_FAILURE);
 	}
 
-	//!< Vulkan T|[g̗L (Vulkan supported)
+	//!< Vulkan サポートの有無 (Vulkan supported)
 	if (GLFW_FALSE == glfwVulkanSupported()) {
 		std::cerr << "Vulkan not supported" << std::endl;
 		glfwTerminate();
 		exit(EXIT_FAILURE);
 	}
 
-	//!< j^[ƃrfI[h (Enumerate monitors and video modes)
+	//!< モニターとビデオモードを列挙 (Enumerate monitors and video modes)
 	int MCount;
 	const auto MPtr = glfwGetMonitors(&MCount);
 	const auto Monitors = std::span(MPtr, MCount);
@@ -243,41 +268,41 @@ int main()
 		}
 	}
 	
-	//!< OpenGL ReLXg쐬Ȃ (Not create OpenGL context)
+	//!< OpenGL コンテキストを作成しない (Not create OpenGL context)
 	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 #ifdef USE_BORDERLESS
-	//!< {[_[Xɂꍇ (Borderless)
+	//!< ボーダーレスにする場合 (Borderless)
 	glfwWindowHint(GLFW_DECORATED, GLFW_FALSE);
 #endif
 
 	auto Width = 800, Height = 600;
-	//!< j^I
+	//!< モニタを選択
 	GLFWmonitor* Mon = nullptr;
 	if (!std::empty(Monitors)) {
 #ifdef USE_EXTFULLSCREEN
-		//!< gj^ (Ō̗vf) I (Select ext monitor)
+		//!< 拡張モニタ (最後の要素) を選択 (Select ext monitor)
 		Mon = Monitors.back();
 #else
-		//!< vC}j^ (ftHg) I (Select primary monitor (default))
+		//!< プライマリモニタ (デフォルト) を選択 (Select primary monitor (default))
 		Mon = *std::ranges::find_if(Monitors, [&](const auto& i) { return i == glfwGetPrimaryMonitor(); });
 #endif
-		//!< rfI[hI
+		//!< ビデオモードを選択
 		int VCount;
 		auto VPtr = glfwGetVideoModes(Mon, &VCount);
 		const auto Vids = std::span(VPtr, VCount);
 		if (!std::empty(Vids)) {
-			//!< 𑜓x̍rfI[h͍Ōɗ񋓂悤Ȃ̂ŁAŌ̗vfI (Most high resolution vide mode will be in last element)
+			//!< 解像度の高いビデオモードは最後に列挙されるようなので、最後の要素を選択 (Most high resolution vide mode will be in last element)
 			const auto Vid = Vids.back();
 			Width = Vid.width;
 			Height = Vid.height;
 		}
 	}
 
-	//!< EChE쐬 (Create window)
-	//!< IɃj^w肵ꍇtXN[ɂȂ (Explicitly select monitor to be fullscreen)
-	//!< tXN[ɂȂꍇ nullptr w肷邱 (Select nullptr to be windowed)
+	//!< ウインドウ作成 (Create window)
+	//!< 明示的にモニタを指定した場合フルスクリーンになる (Explicitly select monitor to be fullscreen)
+	//!< フルスクリーンにしない場合は nullptr を指定すること (Select nullptr to be windowed)
 	const auto GlfwWin = glfwCreateWindow(Width, Height, "Title", Mon, nullptr);
-	//!< R[obNo^ (Register callbacks) EChE쐬ɂĂ
+	//!< コールバック登録 (Register callbacks) ウインドウ作成直後にやっておく
 	glfwSetErrorCallback(GlfwErrorCallback);
 	glfwSetKeyCallback(GlfwWin, GlfwKeyCallback); 
 	glfwSetWindowSizeCallback(GlfwWin, GlfwWindowSizeCallback);
@@ -320,6 +345,10 @@ int main()
 		//, std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Color.dds"
 		//, std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Displacement.dds"
 	);
+	//VirtualDisplacementGlfwVK Vk(GlfwWin
+	//	//, std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Color.dds"
+	//	//, std::filesystem::path("..") / ".." / "Assets" / "Rocks007_2K_Displacement.dds"
+	//);
 	//AnimatedDisplacementGlfwVK Vk(GlfwWin);
 #endif
 
@@ -327,14 +356,17 @@ int main()
 
 	Vk.PopulateCommandBuffer();
 
-	//!< [v (Loop)
+	//!< ループ (Loop)
 	while (!glfwWindowShouldClose(GlfwWin)) {
 		glfwPollEvents();
 			
 		Vk.Render();
 	}
 
-	//!< GLFW Еt (Terminate)
+	//!< exit() ではデストラクタが呼ばれないので、ここで後片付けする (Destructor is not called with exit(), so shut down here)
+	Vk.Shutdown();
+
+	//!< GLFW 後片付け (Terminate)
 	glfwDestroyWindow(GlfwWin);
 	glfwTerminate();
 
@@ -10,6 +10,12 @@ layout (location = 0) out vec4 OutColor;
 
 layout (set = 0, binding = 0) uniform sampler2D Sampler2D;
 
+//!< デバイス毎に固定の値はスペシャライゼーション定数にする (Values fixed per device are specialization constants)
+layout (constant_id = 0) const int TileX = 8;
+layout (constant_id = 1) const int TileY = 6;
+layout (constant_id = 2) const int Ri = 0;
+layout (constant_id = 3) const int Bi = 2;
+
 layout (set = 0, binding = 1) uniform LenticularBuffer
 {
 	float Pitch;
@@ -30,20 +36,20 @@ layout (set = 0, binding = 1) uniform LenticularBuffer
 
 vec2 ToTexcoord(vec3 CoordZ)
 {
-	return (vec2(mod(CoordZ.z, LB.TileX), -sign(LB.Tilt) * floor(CoordZ.z / LB.TileX)) + CoordZ.xy) / vec2(LB.TileX, LB.TileY);
+	return (vec2(mod(CoordZ.z, TileX), -sign(LB.Tilt) * floor(CoordZ.z / TileX)) + CoordZ.xy) / vec2(TileX, TileY);
 }
 
 void main()
 {
 	vec2 UV = InTexcoord;
 
-	//!< Oŕ`悵Ă̂ŁALgƃfBXvC̃AXyNg䒲͕sv
+	//!< 自前で描画しているので、キルトとディスプレイのアスペクト比調整は不要
 
 	if(any(lessThan(UV, vec2(0.0f)))) discard;
 	if(any(lessThan(1.0f - UV, vec2(0.0f)))) discard;
 
 	vec3 RGB[3];
-	const float XY = LB.TileX * LB.TileY;
+	const float XY = TileX * TileY;
 	for(int i = 0;i < 3;++i) {
 		float Z = (InTexcoord.x + i * LB.Subp + InTexcoord.y * LB.Tilt) * LB.Pitch - LB.Center;
 		Z = mod(Z + ceil(abs(Z)), 1.0f) * LB.InvView * XY;
@@ -55,5 +61,5 @@ void main()
 		const vec3 Color2 = texture(Sampler2D, ToTexcoord(CoordZ2)).rgb;
 		RGB[i] = mix(Color1, Color2, Z - CoordZ1.z);
 	}
-	OutColor = vec4(RGB[LB.Ri].r, RGB[1].g, RGB[LB.Bi].b, 1.0);
+	OutColor = vec4(RGB[Ri].r, RGB[1].g, RGB[Bi].b, 1.0);
 }
\ No newline at end of file
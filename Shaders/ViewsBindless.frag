@@ -0,0 +1,22 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#extension GL_EXT_nonuniform_qualifier : enable
+
+layout (location = 0) in vec2 InTexcoord;
+
+layout (set = 1, binding = 1) uniform sampler2D Textures[];
+
+layout (push_constant) uniform BindlessIndex
+{
+	uint ColorMap;
+	uint DisplacementMap;
+} BI;
+
+layout (location = 0) out vec4 Color;
+
+layout (early_fragment_tests) in;
+void main()
+{
+	Color = texture(Textures[nonuniformEXT(BI.ColorMap)], InTexcoord);
+}
\ No newline at end of file
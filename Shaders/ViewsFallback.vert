@@ -0,0 +1,22 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+layout (set = 0, binding = 0) uniform VIEW_PROJECTION_BUFFER
+{
+	mat4 ViewProjection[1];
+} VPB;
+
+layout (set = 0, binding = 3) uniform WorldBuffer
+{
+	mat4 World[1];
+} WB;
+
+layout (location = 0) out vec2 OutTexcoord;
+
+void main()
+{
+	const vec2 UV = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+	OutTexcoord = vec2(UV.x, 1.0f - UV.y);
+	gl_Position = VPB.ViewProjection[0] * WB.World[0] * vec4(2.0f * UV - 1.0f, 0.0f, 1.0f);
+}
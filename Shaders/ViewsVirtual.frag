@@ -0,0 +1,63 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+layout (location = 0) in vec2 InTexcoord;
+
+layout (set = 0, binding = 1) uniform sampler2D ColorMap;
+
+layout (set = 1, binding = 0) readonly buffer PageTable
+{
+	uint Entries[];
+} PT;
+layout (set = 1, binding = 1) buffer Feedback
+{
+	uint Requests[];
+} FB;
+layout (set = 1, binding = 2) uniform VirtualTextureInfo
+{
+	ivec4 Info[2];
+	ivec4 Atlas[2];
+} VTI;
+
+layout (location = 0) out vec4 Color;
+
+const int PageSize = 128;
+const int Border = 1;
+const int SlotSize = PageSize + Border * 2;
+
+ivec2 GetPageCount(const ivec2 Size, const int Level)
+{
+	return (max(Size >> Level, ivec2(1)) + PageSize - 1) / PageSize;
+}
+vec4 SampleVirtual(sampler2D Atlas, const int Index, const vec2 UV, const float Lod)
+{
+	const ivec2 Size = VTI.Info[Index].xy;
+	const int Level = int(clamp(Lod, 0.0f, float(VTI.Info[Index].z)));
+
+	int Offset = VTI.Info[Index].w;
+	for (int i = 0; i < Level; ++i) {
+		const ivec2 PC = GetPageCount(Size, i);
+		Offset += PC.x * PC.y;
+	}
+	const ivec2 PC = GetPageCount(Size, Level);
+	const ivec2 Page = clamp(ivec2(UV * vec2(max(Size >> Level, ivec2(1)))) / PageSize, ivec2(0), PC - 1);
+	const int PageIndex = Offset + Page.y * PC.x + Page.x;
+	FB.Requests[PageIndex] = 1;
+
+	const uint Entry = PT.Entries[PageIndex];
+	const ivec2 Slot = ivec2(Entry & 0xff, (Entry >> 8) & 0xff);
+	const int Resident = int(Entry >> 16);
+	const vec2 LevelSize = vec2(max(Size >> Resident, ivec2(1)));
+	const ivec2 ResidentPage = clamp(ivec2(UV * LevelSize) / PageSize, ivec2(0), GetPageCount(Size, Resident) - 1);
+	const vec2 InPage = clamp(UV * LevelSize - vec2(ResidentPage * PageSize), vec2(0.0f), vec2(PageSize));
+	return textureLod(Atlas, (vec2(Slot * SlotSize + Border) + InPage) / vec2(VTI.Atlas[Index].xy * SlotSize), 0.0f);
+}
+
+layout (early_fragment_tests) in;
+void main()
+{
+	const vec2 UV = InTexcoord * vec2(VTI.Info[0].xy);
+	const float Lod = 0.5f * log2(max(dot(dFdx(UV), dFdx(UV)), dot(dFdy(UV), dFdy(UV))));
+	Color = SampleVirtual(ColorMap, 0, InTexcoord, Lod);
+}
\ No newline at end of file
@@ -1 +1 @@
-@for %%i in (*.vert, *.frag, *.tese, *.tesc, *.geom) do glslangValidator -V %%i -o %%i.spv --target-env vulkan1.3 -g -Od
+@for %%i in (*.vert, *.frag, *.tese, *.tesc, *.geom, *.comp) do glslangValidator -V %%i -o %%i.spv --target-env vulkan1.3 -g -Od
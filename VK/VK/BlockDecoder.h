@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+//!< ブロック圧縮 (BC1 - BC5) を CPU で RGBA8 へ展開する、デバイスが BC をサポートしない場合のフォールバック用
+//!< (Decode block compression (BC1 - BC5) into RGBA8 on CPU, for fallback when device does not support BC)
+//!< BC6H, BC7, ETC2, ASTC, SNORM は扱わない、IsDecodable() が false になる (BC6H, BC7, ETC2, ASTC, SNORM are not handled, IsDecodable() returns false)
+class BlockDecoder
+{
+public:
+	[[nodiscard]] static bool IsDecodable(const gli::format Format) {
+		switch (Format) {
+			using enum gli::format;
+		case FORMAT_RGB_DXT1_UNORM_BLOCK8:
+		case FORMAT_RGB_DXT1_SRGB_BLOCK8:
+		case FORMAT_RGBA_DXT1_UNORM_BLOCK8:
+		case FORMAT_RGBA_DXT1_SRGB_BLOCK8:
+		case FORMAT_RGBA_DXT3_UNORM_BLOCK16:
+		case FORMAT_RGBA_DXT3_SRGB_BLOCK16:
+		case FORMAT_RGBA_DXT5_UNORM_BLOCK16:
+		case FORMAT_RGBA_DXT5_SRGB_BLOCK16:
+		case FORMAT_R_ATI1N_UNORM_BLOCK8:
+		case FORMAT_RG_ATI2N_UNORM_BLOCK16:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	//!< Src は Width, Height を覆うブロック列、Dst は Width * Height * 4 バイト (Src is blocks covering Width, Height, Dst is Width * Height * 4 bytes)
+	//!< sRGB のものは値をそのまま書き出すので、出力側も sRGB フォーマットにすること (sRGB ones are written as is, so output should also be sRGB format)
+	static void Decode(const gli::format Format, const std::byte* Src, const uint32_t Width, const uint32_t Height, std::byte* Dst) {
+		const auto BlockSize = gli::block_size(Format);
+		for (uint32_t y = 0; y < Height; y += 4) {
+			for (uint32_t x = 0; x < Width; x += 4, Src += BlockSize) {
+				std::array<uint8_t, 4 * 4 * 4> Texels;
+				DecodeBlock(Format, reinterpret_cast<const uint8_t*>(Src), std::data(Texels));
+				//!< 端のブロックは範囲内のテクセルのみ書き出す (Write only texels in range for edge blocks)
+				const auto W = (std::min)(Width - x, 4u), H = (std::min)(Height - y, 4u);
+				for (uint32_t j = 0; j < H; ++j) {
+					std::memcpy(Dst + (static_cast<size_t>(y + j) * Width + x) * 4, &Texels[j * 4 * 4], W * 4);
+				}
+			}
+		}
+	}
+
+protected:
+	static uint16_t Read16(const uint8_t* Src) { return static_cast<uint16_t>(Src[0] | (Src[1] << 8)); }
+	static uint32_t Read32(const uint8_t* Src) { return static_cast<uint32_t>(Src[0]) | (static_cast<uint32_t>(Src[1]) << 8) | (static_cast<uint32_t>(Src[2]) << 16) | (static_cast<uint32_t>(Src[3]) << 24); }
+
+	static void DecodeBlock(const gli::format Format, const uint8_t* Src, uint8_t* Dst) {
+		switch (Format) {
+			using enum gli::format;
+		case FORMAT_RGB_DXT1_UNORM_BLOCK8:
+		case FORMAT_RGB_DXT1_SRGB_BLOCK8:
+			DecodeColor(Src, Dst, false, false);
+			break;
+		case FORMAT_RGBA_DXT1_UNORM_BLOCK8:
+		case FORMAT_RGBA_DXT1_SRGB_BLOCK8:
+			DecodeColor(Src, Dst, false, true);
+			break;
+		case FORMAT_RGBA_DXT3_UNORM_BLOCK16:
+		case FORMAT_RGBA_DXT3_SRGB_BLOCK16:
+			DecodeColor(Src + 8, Dst, true, false);
+			//!< 4 ビットの明示的なアルファ (Explicit 4 bit alpha)
+			for (auto i = 0; i < 16; ++i) {
+				const auto A = (Src[i >> 1] >> ((i & 1) * 4)) & 0xf;
+				Dst[i * 4 + 3] = static_cast<uint8_t>(A * 17);
+			}
+			break;
+		case FORMAT_RGBA_DXT5_UNORM_BLOCK16:
+		case FORMAT_RGBA_DXT5_SRGB_BLOCK16:
+			DecodeColor(Src + 8, Dst, true, false);
+			DecodeChannel(Src, Dst + 3);
+			break;
+		case FORMAT_R_ATI1N_UNORM_BLOCK8:
+			DecodeChannel(Src, Dst);
+			for (auto i = 0; i < 16; ++i) { Dst[i * 4 + 1] = 0; Dst[i * 4 + 2] = 0; Dst[i * 4 + 3] = 0xff; }
+			break;
+		case FORMAT_RG_ATI2N_UNORM_BLOCK16:
+			DecodeChannel(Src, Dst);
+			DecodeChannel(Src + 8, Dst + 1);
+			for (auto i = 0; i < 16; ++i) { Dst[i * 4 + 2] = 0; Dst[i * 4 + 3] = 0xff; }
+			break;
+		default:
+			break;
+		}
+	}
+	//!< BC1 のカラーブロック (8 バイト) (Color block of BC1 (8 bytes))
+	//!< BC2, BC3 のカラーは常に 4 色モード、BC1 で Color0 <= Color1 の場合は 3 色 + 黒 (透明) (BC2, BC3 color is always 4 color mode, BC1 with Color0 <= Color1 is 3 colors + black (transparent))
+	static void DecodeColor(const uint8_t* Src, uint8_t* Dst, const bool Always4, const bool PunchThrough) {
+		const auto C0 = Read16(Src), C1 = Read16(Src + 2);
+		const auto Expand = [](const uint16_t C) {
+			const auto R = (C >> 11) & 0x1f, G = (C >> 5) & 0x3f, B = C & 0x1f;
+			return std::array<int, 3>({ (R << 3) | (R >> 2), (G << 2) | (G >> 4), (B << 3) | (B >> 2) });
+		};
+		const auto E0 = Expand(C0), E1 = Expand(C1);
+		std::array<std::array<uint8_t, 4>, 4> Palette;
+		for (auto i = 0; i < 3; ++i) {
+			Palette[0][i] = static_cast<uint8_t>(E0[i]);
+			Palette[1][i] = static_cast<uint8_t>(E1[i]);
+			if (Always4 || C0 > C1) {
+				Palette[2][i] = static_cast<uint8_t>((2 * E0[i] + E1[i]) / 3);
+				Palette[3][i] = static_cast<uint8_t>((E0[i] + 2 * E1[i]) / 3);
+			}
+			else {
+				Palette[2][i] = static_cast<uint8_t>((E0[i] + E1[i]) / 2);
+				Palette[3][i] = 0;
+			}
+		}
+		Palette[0][3] = Palette[1][3] = Palette[2][3] = 0xff;
+		Palette[3][3] = (!Always4 && C0 <= C1 && PunchThrough) ? 0 : 0xff;
+
+		const auto Indices = Read32(Src + 4);
+		for (auto i = 0; i < 16; ++i) {
+			std::memcpy(Dst + i * 4, std::data(Palette[(Indices >> (i * 2)) & 0x3]), 4);
+		}
+	}
+	//!< BC3 のアルファ、BC4, BC5 のチャンネルブロック (8 バイト)、Dst へ 4 バイト間隔で書き出す
+	//!< (Alpha of BC3, channel block of BC4, BC5 (8 bytes), written to Dst with 4 bytes stride)
+	static void DecodeChannel(const uint8_t* Src, uint8_t* Dst) {
+		const int V0 = Src[0], V1 = Src[1];
+		std::array<uint8_t, 8> Palette;
+		Palette[0] = static_cast<uint8_t>(V0);
+		Palette[1] = static_cast<uint8_t>(V1);
+		if (V0 > V1) {
+			for (auto i = 1; i < 7; ++i) { Palette[i + 1] = static_cast<uint8_t>(((7 - i) * V0 + i * V1) / 7); }
+		}
+		else {
+			for (auto i = 1; i < 5; ++i) { Palette[i + 1] = static_cast<uint8_t>(((5 - i) * V0 + i * V1) / 5); }
+			Palette[6] = 0;
+			Palette[7] = 0xff;
+		}
+
+		//!< 3 ビット x 16 のインデックス (48 ビット) (3 bit x 16 indices (48 bits))
+		uint64_t Indices = 0;
+		for (auto i = 0; i < 6; ++i) { Indices |= static_cast<uint64_t>(Src[2 + i]) << (i * 8); }
+		for (auto i = 0; i < 16; ++i) {
+			Dst[i * 4] = Palette[(Indices >> (i * 3)) & 0x7];
+		}
+	}
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <mutex>
+#include <algorithm>
+
+//!< デスクリプタセットアロケータ (Descriptor set allocator)
+//!< プールが足りなくなったら (セット数を倍にしながら) プールを追加する、Reset() で全プールをリセットして再利用する (フレーム毎の一時的なセット用)
+//!< (Add pool (doubling set count) when exhausted, Reset() resets all pools for reuse (for per frame transient sets))
+class DescriptorAllocator
+{
+public:
+	//!< セット 1 つ当たりのデスクリプタ数 (Descriptor count per set)
+	struct PoolSizeRatio
+	{
+		VkDescriptorType Type;
+		float Ratio;
+	};
+
+	void Init(const VkDevice Dev, const uint32_t InitialSetCount, std::span<const PoolSizeRatio> PSRs, const VkDescriptorPoolCreateFlags DPCF = 0) {
+		Device = Dev;
+		SetCount = InitialSetCount;
+		Ratios.assign(std::begin(PSRs), std::end(PSRs));
+		Flags = DPCF;
+	}
+	void Destroy() {
+		if (VK_NULL_HANDLE == Device) { return; }
+		for (auto i : ReadyPools) { vkDestroyDescriptorPool(Device, i, nullptr); }
+		for (auto i : FullPools) { vkDestroyDescriptorPool(Device, i, nullptr); }
+		ReadyPools.clear();
+		FullPools.clear();
+	}
+
+	VkDescriptorSet Allocate(const VkDescriptorSetLayout DSL, const void* pNext = nullptr) {
+		std::lock_guard Lock(Mutex);
+
+		auto DP = GetPool();
+		VkDescriptorSetAllocateInfo DSAI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			.pNext = pNext,
+			.descriptorPool = DP,
+			.descriptorSetCount = 1, .pSetLayouts = &DSL
+		};
+		VkDescriptorSet DS = VK_NULL_HANDLE;
+		const auto VR = vkAllocateDescriptorSets(Device, &DSAI, &DS);
+		if (VK_ERROR_OUT_OF_POOL_MEMORY == VR || VK_ERROR_FRAGMENTED_POOL == VR) {
+			//!< 使い切ったプールは満杯リストへ移し、新しいプールから確保し直す (Move exhausted pool to full list, and retry with new pool)
+			FullPools.emplace_back(DP);
+			ReadyPools.pop_back();
+			DSAI.descriptorPool = DP = GetPool();
+			VERIFY_SUCCEEDED(vkAllocateDescriptorSets(Device, &DSAI, &DS));
+		}
+		else {
+			VERIFY_SUCCEEDED(VR);
+		}
+		return DS;
+	}
+
+	//!< 確保したセットは全て無効になる、GPU が使用し終えてから呼ぶこと (All allocated sets become invalid, call after GPU has finished using them)
+	void Reset() {
+		std::lock_guard Lock(Mutex);
+
+		for (auto i : ReadyPools) { VERIFY_SUCCEEDED(vkResetDescriptorPool(Device, i, 0)); }
+		for (auto i : FullPools) {
+			VERIFY_SUCCEEDED(vkResetDescriptorPool(Device, i, 0));
+			ReadyPools.emplace_back(i);
+		}
+		FullPools.clear();
+	}
+
+protected:
+	VkDescriptorPool GetPool() {
+		if (std::empty(ReadyPools)) {
+			ReadyPools.emplace_back(CreatePool(SetCount));
+			//!< 次に作成するプールは大きくする (Next pool will be larger)
+			SetCount = (std::min)(SetCount * 2, MaxSetCount);
+		}
+		return ReadyPools.back();
+	}
+	VkDescriptorPool CreatePool(const uint32_t Count) const {
+		std::vector<VkDescriptorPoolSize> DPSs;
+		DPSs.reserve(std::size(Ratios));
+		for (const auto& i : Ratios) {
+			DPSs.emplace_back(VkDescriptorPoolSize({ .type = i.Type, .descriptorCount = (std::max)(static_cast<uint32_t>(i.Ratio * Count), 1u) }));
+		}
+		const VkDescriptorPoolCreateInfo DPCI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+			.pNext = nullptr,
+			.flags = Flags,
+			.maxSets = Count,
+			.poolSizeCount = static_cast<uint32_t>(std::size(DPSs)), .pPoolSizes = std::data(DPSs)
+		};
+		VkDescriptorPool DP;
+		VERIFY_SUCCEEDED(vkCreateDescriptorPool(Device, &DPCI, nullptr, &DP));
+		return DP;
+	}
+
+	static constexpr uint32_t MaxSetCount = 4096;
+
+	VkDevice Device = VK_NULL_HANDLE;
+	std::vector<PoolSizeRatio> Ratios;
+	VkDescriptorPoolCreateFlags Flags = 0;
+	uint32_t SetCount = 0;
+	//!< 確保可能なプール、満杯のプール (Pools available for allocation, exhausted pools)
+	std::vector<VkDescriptorPool> ReadyPools;
+	std::vector<VkDescriptorPool> FullPools;
+	std::mutex Mutex;
+};
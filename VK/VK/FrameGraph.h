@@ -0,0 +1,310 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <limits>
+
+//!< 簡易フレームグラフ (Simple frame graph)
+//!< パスは読み書きするリソースを宣言するだけで、実行順、不要パスのカリング、バリア (レイアウト遷移) はグラフ側で導出する
+//!< (Passes only declare reads and writes, graph derives execution order, culling and barriers (layout transitions))
+class FrameGraph
+{
+public:
+	using Handle = uint32_t;
+	struct Usage
+	{
+		VkPipelineStageFlags2 Stage = VK_PIPELINE_STAGE_2_NONE;
+		VkAccessFlags2 Access = VK_ACCESS_2_NONE;
+		VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+	};
+	struct Resource
+	{
+		std::string Name;
+		VkImage Image = VK_NULL_HANDLE;
+		VkImageSubresourceRange ISR;
+		//!< フレーム開始時の状態 (State at the beginning of frame)
+		Usage Initial;
+		//!< フレーム終了時に遷移するレイアウト、UNDEFINED なら最後に使用したレイアウトのまま (Layout at the end of frame, UNDEFINED keeps last used layout)
+		VkImageLayout Final = VK_IMAGE_LAYOUT_UNDEFINED;
+		//!< グラフ外から参照される (カリングの起点となる) (Referenced from outside of graph, culling starts from here)
+		bool IsExported = false;
+	};
+	class Pass
+	{
+		friend class FrameGraph;
+	public:
+		Pass& Read(const Handle H, const VkPipelineStageFlags2 PSF, const VkAccessFlags2 AF, const VkImageLayout IL) {
+			Reads.emplace_back(H, Usage({ .Stage = PSF, .Access = AF, .Layout = IL }));
+			return *this;
+		}
+		//!< 読み込みを伴わない書き込みは以前の内容を破棄してよいものとして扱う (Write without read discards previous contents)
+		Pass& Write(const Handle H, const VkPipelineStageFlags2 PSF, const VkAccessFlags2 AF, const VkImageLayout IL) {
+			Writes.emplace_back(H, Usage({ .Stage = PSF, .Access = AF, .Layout = IL }));
+			return *this;
+		}
+		//!< 出力が参照されなくてもカリングしない (Never culled even if outputs are not referenced)
+		Pass& SideEffect() { HasSideEffect = true; return *this; }
+
+	private:
+		std::string Name;
+		std::function<void(const VkCommandBuffer)> Function;
+		std::vector<std::pair<Handle, Usage>> Reads;
+		std::vector<std::pair<Handle, Usage>> Writes;
+		bool HasSideEffect = false;
+	};
+
+	Handle ImportImage(std::string_view Name, const VkImage Image, const Usage& Initial, const VkImageLayout Final = VK_IMAGE_LAYOUT_UNDEFINED,
+		const VkImageSubresourceRange& ISR = VkImageSubresourceRange({ .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS, .baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS })) {
+		Resources.emplace_back(Resource({ .Name = std::string(Name), .Image = Image, .ISR = ISR, .Initial = Initial, .Final = Final, .IsExported = VK_IMAGE_LAYOUT_UNDEFINED != Final }));
+		return static_cast<Handle>(std::size(Resources) - 1);
+	}
+	void Export(const Handle H) { Resources[H].IsExported = true; }
+	Handle Find(std::string_view Name) const {
+		const auto It = std::ranges::find_if(Resources, [&](const auto& rhs) { return rhs.Name == Name; });
+		return std::end(Resources) != It ? static_cast<Handle>(std::distance(std::begin(Resources), It)) : (std::numeric_limits<Handle>::max)();
+	}
+
+	//!< 返した参照は (deque なので) 以降の AddPass() でも無効にならない (Returned reference stays valid, as stored in deque)
+	Pass& AddPass(std::string_view Name, std::function<void(const VkCommandBuffer)> Function) {
+		auto& P = Passes.emplace_back();
+		P.Name = Name;
+		P.Function = std::move(Function);
+		return P;
+	}
+
+	void Compile() {
+		constexpr auto NotFound = (std::numeric_limits<size_t>::max)();
+		const auto PassCount = std::size(Passes);
+
+		//!< 依存関係の構築、宣言順がデータの流れを決める (Build dependencies, declaration order defines data flow)
+		std::vector<std::vector<size_t>> Producers(PassCount); //!< RAW (生存判定用) (For liveness)
+		std::vector<std::vector<size_t>> Dependencies(PassCount); //!< RAW, WAW, WAR (実行順用) (For ordering)
+		std::vector<size_t> LastWriters(std::size(Resources), NotFound);
+		{
+			std::vector<std::vector<size_t>> Readers(std::size(Resources));
+			for (size_t i = 0; i < PassCount; ++i) {
+				const auto& P = Passes[i];
+				for (const auto& [H, U] : P.Reads) {
+					if (NotFound != LastWriters[H]) {
+						Producers[i].emplace_back(LastWriters[H]);
+						Dependencies[i].emplace_back(LastWriters[H]);
+					}
+				}
+				for (const auto& [H, U] : P.Writes) {
+					if (NotFound != LastWriters[H]) {
+						Dependencies[i].emplace_back(LastWriters[H]);
+					}
+					for (auto j : Readers[H]) {
+						if (j != i) { Dependencies[i].emplace_back(j); }
+					}
+				}
+				for (const auto& [H, U] : P.Reads) { Readers[H].emplace_back(i); }
+				for (const auto& [H, U] : P.Writes) { LastWriters[H] = i; Readers[H].clear(); }
+			}
+			for (auto& i : Dependencies) {
+				std::ranges::sort(i);
+				const auto [First, Last] = std::ranges::unique(i);
+				i.erase(First, Last);
+			}
+		}
+
+		//!< カリング、エクスポートされたリソースの最終書き込みパスと副作用のあるパスから辿れないものは除外 (Culling, remove passes not reachable from last writer of exported resources or side effect passes)
+		std::vector<bool> IsAlive(PassCount, false);
+		{
+			std::vector<size_t> Stack;
+			for (size_t i = 0; i < std::size(Resources); ++i) {
+				if (Resources[i].IsExported && NotFound != LastWriters[i]) { Stack.emplace_back(LastWriters[i]); }
+			}
+			for (size_t i = 0; i < PassCount; ++i) {
+				if (Passes[i].HasSideEffect) { Stack.emplace_back(i); }
+			}
+			while (!std::empty(Stack)) {
+				const auto i = Stack.back(); Stack.pop_back();
+				if (IsAlive[i]) { continue; }
+				IsAlive[i] = true;
+				for (auto j : Producers[i]) { Stack.emplace_back(j); }
+			}
+		}
+
+		//!< 実行順 (トポロジカルソート)、直前のパスに依存しないパスを優先して間に挟み、バリアでの待ちを重ねる
+		//!< (Execution order (topological sort), prefer passes whose dependencies were scheduled earliest so that independent work overlaps barrier waits)
+		Order.clear();
+		{
+			std::vector<size_t> InDegrees(PassCount, 0);
+			std::vector<std::vector<size_t>> Successors(PassCount);
+			for (size_t i = 0; i < PassCount; ++i) {
+				if (!IsAlive[i]) { continue; }
+				for (auto j : Dependencies[i]) {
+					if (IsAlive[j]) { ++InDegrees[i]; Successors[j].emplace_back(i); }
+				}
+			}
+			//!< 実行順での位置 + 1 (0 は未実行) (Position in order + 1, 0 means not scheduled)
+			std::vector<size_t> Positions(PassCount, 0);
+			const auto LatestDependency = [&](const size_t i) {
+				size_t Latest = 0;
+				for (auto j : Dependencies[i]) { if (IsAlive[j]) { Latest = (std::max)(Latest, Positions[j]); } }
+				return Latest;
+			};
+			std::vector<size_t> Ready;
+			for (size_t i = 0; i < PassCount; ++i) {
+				if (IsAlive[i] && 0 == InDegrees[i]) { Ready.emplace_back(i); }
+			}
+			while (!std::empty(Ready)) {
+				const auto It = std::ranges::min_element(Ready, [&](const auto lhs, const auto rhs) {
+					const auto L = LatestDependency(lhs), R = LatestDependency(rhs);
+					return L != R ? L < R : lhs < rhs;
+					});
+				const auto i = *It;
+				Ready.erase(It);
+				Order.emplace_back(i);
+				Positions[i] = std::size(Order);
+				for (auto j : Successors[i]) {
+					if (0 == --InDegrees[j]) { Ready.emplace_back(j); }
+				}
+			}
+		}
+
+		//!< 実行順に状態を追跡してバリアを導出 (Derive barriers by tracking states in execution order)
+		struct State
+		{
+			VkImageLayout Layout;
+			VkPipelineStageFlags2 WriteStage;
+			VkAccessFlags2 WriteAccess;
+			VkPipelineStageFlags2 ReadStage;
+			//!< 最後の書き込みが既に可視になっているステージ (Stages which last write is already visible to)
+			VkPipelineStageFlags2 VisibleStage;
+		};
+		std::vector<State> States;
+		States.reserve(std::size(Resources));
+		for (const auto& i : Resources) {
+			States.emplace_back(State({ .Layout = i.Initial.Layout, .WriteStage = i.Initial.Stage, .WriteAccess = i.Initial.Access, .ReadStage = VK_PIPELINE_STAGE_2_NONE, .VisibleStage = VK_PIPELINE_STAGE_2_NONE }));
+		}
+
+		Barriers.assign(std::size(Order), {});
+		for (size_t i = 0; i < std::size(Order); ++i) {
+			const auto& P = Passes[Order[i]];
+
+			//!< パス内で同一リソースへの読み書きをまとめる (Merge reads and writes of same resource in pass)
+			struct Access
+			{
+				Handle H;
+				Usage U;
+				bool IsRead = false, IsWrite = false;
+			};
+			std::vector<Access> Accesses;
+			const auto Merge = [&](const Handle H, const Usage& U, const bool IsWrite) {
+				auto It = std::ranges::find_if(Accesses, [&](const auto& rhs) { return rhs.H == H; });
+				if (std::end(Accesses) == It) {
+					Accesses.emplace_back(Access({ .H = H, .U = U }));
+					It = std::prev(std::end(Accesses));
+				}
+				else {
+					It->U.Stage |= U.Stage;
+					It->U.Access |= U.Access;
+					if (It->U.Layout != U.Layout) { BREAKPOINT(); }
+				}
+				(IsWrite ? It->IsWrite : It->IsRead) = true;
+			};
+			for (const auto& [H, U] : P.Reads) { Merge(H, U, false); }
+			for (const auto& [H, U] : P.Writes) { Merge(H, U, true); }
+
+			for (const auto& A : Accesses) {
+				auto& S = States[A.H];
+				const auto IsLayoutChanged = S.Layout != A.U.Layout;
+				if (IsLayoutChanged || A.IsWrite) {
+					//!< レイアウト遷移、WAW、WAR (Layout transition, WAW, WAR)
+					const auto SrcStage = S.WriteStage | S.ReadStage;
+					if (IsLayoutChanged || VK_PIPELINE_STAGE_2_NONE != SrcStage) {
+						Barriers[i].emplace_back(CreateBarrier(Resources[A.H],
+							SrcStage, S.WriteAccess, A.U.Stage, A.U.Access,
+							//!< 読み込まない場合は以前の内容を破棄する (Discard previous contents if not read)
+							(IsLayoutChanged && !A.IsRead) ? VK_IMAGE_LAYOUT_UNDEFINED : S.Layout, A.U.Layout));
+					}
+					if (A.IsWrite) {
+						S = State({ .Layout = A.U.Layout, .WriteStage = A.U.Stage, .WriteAccess = A.U.Access, .ReadStage = VK_PIPELINE_STAGE_2_NONE, .VisibleStage = VK_PIPELINE_STAGE_2_NONE });
+					}
+					else {
+						//!< レイアウト遷移は書き込み扱い、遷移自体は後続ステージから可視 (Layout transition is treated as write, visible to destination stage)
+						S = State({ .Layout = A.U.Layout, .WriteStage = A.U.Stage, .WriteAccess = VK_ACCESS_2_NONE, .ReadStage = A.U.Stage, .VisibleStage = A.U.Stage });
+					}
+				}
+				else {
+					//!< RAW、既に可視になっているステージからの読み込みならバリア不要 (RAW, barrier is not needed if already visible to the stage)
+					if ((A.U.Stage & ~S.VisibleStage) && VK_PIPELINE_STAGE_2_NONE != S.WriteStage) {
+						Barriers[i].emplace_back(CreateBarrier(Resources[A.H],
+							S.WriteStage, S.WriteAccess, A.U.Stage, A.U.Access,
+							S.Layout, S.Layout));
+						S.VisibleStage |= A.U.Stage;
+					}
+					S.ReadStage |= A.U.Stage;
+				}
+			}
+		}
+
+		//!< 最終レイアウトへの遷移 (Transition to final layout)
+		FinalBarriers.clear();
+		for (size_t i = 0; i < std::size(Resources); ++i) {
+			const auto& R = Resources[i];
+			const auto& S = States[i];
+			if (VK_IMAGE_LAYOUT_UNDEFINED != R.Final && S.Layout != R.Final) {
+				FinalBarriers.emplace_back(CreateBarrier(R,
+					S.WriteStage | S.ReadStage, S.WriteAccess, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE,
+					S.Layout, R.Final));
+			}
+		}
+
+#ifdef _DEBUG
+		for (size_t i = 0; i < PassCount; ++i) {
+			if (!IsAlive[i]) { std::cout << "[FrameGraph] Culled : " << Passes[i].Name << std::endl; }
+		}
+#endif
+	}
+
+	void Execute(const VkCommandBuffer CB) const {
+		for (size_t i = 0; i < std::size(Order); ++i) {
+			PipelineBarrier(CB, Barriers[i]);
+			Passes[Order[i]].Function(CB);
+		}
+		PipelineBarrier(CB, FinalBarriers);
+	}
+
+protected:
+	static VkImageMemoryBarrier2 CreateBarrier(const Resource& R,
+		const VkPipelineStageFlags2 SrcPSF, const VkAccessFlags2 SrcAF, const VkPipelineStageFlags2 DstPSF, const VkAccessFlags2 DstAF,
+		const VkImageLayout OldIL, const VkImageLayout NewIL) {
+		return VkImageMemoryBarrier2({
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+			.pNext = nullptr,
+			.srcStageMask = SrcPSF, .srcAccessMask = SrcAF, .dstStageMask = DstPSF, .dstAccessMask = DstAF,
+			.oldLayout = OldIL, .newLayout = NewIL,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = R.Image,
+			.subresourceRange = R.ISR,
+		});
+	}
+	//!< パス毎にまとめて 1 回で発行する (Issue once per pass)
+	static void PipelineBarrier(const VkCommandBuffer CB, const std::vector<VkImageMemoryBarrier2>& IMBs) {
+		if (std::empty(IMBs)) { return; }
+		const VkDependencyInfo DI = {
+			.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+			.pNext = nullptr,
+			.dependencyFlags = 0,
+			.memoryBarrierCount = 0, .pMemoryBarriers = nullptr,
+			.bufferMemoryBarrierCount = 0, .pBufferMemoryBarriers = nullptr,
+			.imageMemoryBarrierCount = static_cast<uint32_t>(std::size(IMBs)), .pImageMemoryBarriers = std::data(IMBs),
+		};
+		vkCmdPipelineBarrier2(CB, &DI);
+	}
+
+	std::vector<Resource> Resources;
+	std::deque<Pass> Passes;
+
+	//!< Compile() の結果 (Results of Compile())
+	std::vector<size_t> Order;
+	std::vector<std::vector<VkImageMemoryBarrier2>> Barriers;
+	std::vector<VkImageMemoryBarrier2> FinalBarriers;
+};
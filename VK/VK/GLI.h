@@ -16,6 +16,9 @@
 #endif
 #include <gli/gli.hpp>
 #include <gli/target.hpp>
+#include <gli/convert.hpp>
+#include <gli/dx.hpp>
+#include <gli/gl.hpp>
 #ifdef _WIN64
 #pragma warning(pop)
 #else
@@ -25,8 +25,8 @@
 class Hailo
 {
 public:
-	//!< J摜擾̂ɕKvȁAcv::VideoCapture() ֈ () 쐬
-	//!< (OpenCV ł BGR Ȃ̂ "format=BGR" w肷Kv)
+	//!< カメラ画像を取得するのに必要な、cv::VideoCapture() へ引数 (文字列) を作成
+	//!< (OpenCV では BGR なので "format=BGR" を指定する必要がある)
 	static std::string GetLibCameGSTStr(const int Width, const int Height, const int FPS) {
 		//return std::format("libcamerasrc ! video/x-raw, width={}, height={}, framerate={}/1, format=BGR, ! appsink", Width, Height, FPS);
 		std::stringstream SS;
@@ -38,11 +38,11 @@ public:
 		Flags.set(static_cast<size_t>(FLAGS::IsRunning));
 		Flags.set(static_cast<size_t>(FLAGS::HasInput));
 
-		//!< foCX
+		//!< デバイス
 		hailo_device Device;
 		hailo_create_pcie_device(nullptr, &Device);
 
-		//!< lbg[N
+		//!< ネットワーク
 		hailo_hef Hef;
 		hailo_create_hef_file(&Hef, std::data(HefFile));
 		hailo_configure_params_t ConfigureParams;
@@ -55,7 +55,7 @@ public:
 
 		auto& CNG = ConfiguredNetworkGroups.front();
 
-		//!< o̓p[^
+		//!< 入出力パラメータ
 		std::vector<hailo_input_vstream_params_by_name_t> InputVstreamParamsByName(HAILO_MAX_STREAM_NAME_SIZE);
 		Count = std::size(InputVstreamParamsByName);
 		hailo_make_input_vstream_params(CNG, true, HAILO_FORMAT_TYPE_UINT8, std::data(InputVstreamParamsByName), &Count);
@@ -66,33 +66,33 @@ public:
 		hailo_make_output_vstream_params(CNG, false, HAILO_FORMAT_TYPE_FLOAT32, std::data(OutputVstreamParamsByName), &Count);
 		OutputVstreamParamsByName.resize(Count);
 
-		//!< o (͂֏ނ AI ɏďo͂ɕԂ)
+		//!< 入出力 (入力へ書き込むと AI に処理されて出力に返る)
 		hailo_input_vstream InputVstreams;
 		hailo_create_input_vstreams(CNG, std::data(InputVstreamParamsByName), std::size(InputVstreamParamsByName), &InputVstreams);
 
 		hailo_output_vstream OutputVstreams;
 		hailo_create_output_vstreams(CNG, std::data(OutputVstreamParamsByName), std::size(OutputVstreamParamsByName), &OutputVstreams);
 
-		//!< AI lbg[ÑANeBx[g
+		//!< AI ネットワークのアクティベート
 		hailo_activated_network_group ActivatedNetworkGroup;
 		hailo_activate_network_group(CNG, nullptr, &ActivatedNetworkGroup);
 
-		//!< _Jn
+		//!< 推論開始
 		Inference(InputVstreams, OutputVstreams, CapturePath);
 
-		//!< [v
+		//!< ループ
 		do {
 			Flags[static_cast<size_t>(FLAGS::IsRunning)] = Loop();
 		} while (Flags.all());
 
-		//!< IAXbh
+		//!< 終了、スレッド同期
 		Join();
 	}
 
-	//!< pNXŃI[o[Ch
+	//!< 継承クラスでオーバーライド
 	virtual void Inference([[maybe_unused]] hailo_input_vstream& In, [[maybe_unused]] hailo_output_vstream& Out, [[maybe_unused]] std::string_view CapturePath) {}
 
-	//!< Xbh
+	//!< スレッド同期
 	void Join() {
 		for (auto& i : Threads) {
 			i.join();
@@ -116,7 +116,7 @@ private:
 
 public:
 	virtual void Inference(hailo_input_vstream& In, hailo_output_vstream& Out, std::string_view CapturePath) override {
-		//!< AI ̓Xbh
+		//!< AI 入力スレッド
 		Threads.emplace_back([&]() {
 			cv::VideoCapture Capture(std::data(CapturePath));
 			std::cout << Capture.get(cv::CAP_PROP_FRAME_WIDTH) << " x " << Capture.get(cv::CAP_PROP_FRAME_HEIGHT) << " @ " << Capture.get(cv::CAP_PROP_FPS) << std::endl;
@@ -128,13 +128,13 @@ public:
 			hailo_get_input_vstream_frame_size(In, &FrameSize);
 
 			cv::Mat InAI;
-			//!< XbhgɏIf
+			//!< スレッド自身に終了判断させる
 			while (Flags.all()) {
-				//!< ͂Əo͂YĂȂ悤ɓ
+				//!< 入力と出力がズレていかないように同期する
 				if (InFrameCount > OutFrameCount) { continue; }
 				++InFrameCount;
 
-				//!< t[擾
+				//!< フレームを取得
 				Capture >> ColorMap;
 				if (ColorMap.empty()) {
 					std::cout << "Lost input" << std::endl;
@@ -142,7 +142,7 @@ public:
 					break;
 				}
 
-				//!< TCY
+				//!< リサイズ
 				if (static_cast<uint32_t>(ColorMap.cols) != Shape.width || static_cast<uint32_t>(ColorMap.rows) != Shape.height) {
 					cv::resize(ColorMap, InAI, cv::Size(Shape.width, Shape.height), cv::INTER_AREA);
 				}
@@ -150,12 +150,12 @@ public:
 					InAI = ColorMap.clone();
 				}
 
-				//!< AI ւ̓ ()
+				//!< AI への入力 (書き込み)
 				hailo_vstream_write_raw_buffer(In, InAI.data, FrameSize);
 			}
 		});
 
-		//!< AI o̓Xbh
+		//!< AI 出力スレッド
 		Threads.emplace_back([&]() {
 			hailo_vstream_info_t Info;
 			hailo_get_output_vstream_info(Out, &Info);
@@ -164,31 +164,31 @@ public:
 			hailo_get_output_vstream_frame_size(Out, &FrameSize);
 
 			std::vector<uint8_t> OutAI(FrameSize);
-			//!< XbhgɏIf
+			//!< スレッド自身に終了判断させる
 			while (Flags.all()) {
 				++OutFrameCount;
 
-				//!< o͂擾
+				//!< 出力を取得
 				hailo_vstream_read_raw_buffer(Out, std::data(OutAI), FrameSize);
 
-				//!< OpenCV `
+				//!< OpenCV 形式へ
 				const auto CVOutAI = cv::Mat(Shape.height, Shape.width, CV_32F, std::data(OutAI));
 
 				{
 					std::lock_guard Lock(OutMutex);
 
-					//!< [x}bv̒
+					//!< 深度マップの調整
 					DepthMap = cv::Mat(Shape.height, Shape.width, CV_32F, cv::Scalar(0));
-					//!< -CVOutAI wƂĎRΐ̒ e ׂ̂悪 DepthMap ɕԂ
+					//!< -CVOutAI を指数として自然対数の底 e のべき乗が DepthMap に返る
 					cv::exp(-CVOutAI, DepthMap);
 					DepthMap = 1 / (1 + DepthMap);
 					DepthMap = 1 / (DepthMap * 10 + 0.009);
 
 					double Mn, Mx;
 					cv::minMaxIdx(DepthMap, &Mn, &Mx);
-					//!< OA
+					//!< 手前が黒、奥が白
 					//DepthMap.convertTo(DepthMap, CV_8U, 255 / (Mx - Mn), -Mn);
-					//!< OA (t)
+					//!< 手前が白、奥が黒 (逆)
 					DepthMap.convertTo(DepthMap, CV_8U, -255 / (Mx - Mn), -Mn + 255);
 				}
 			}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <span>
+
+//!< ワークスティーリング型ジョブシステム (Work stealing job system)
+//!< ワーカー毎にキューを持ち、自分のキューは後ろから (LIFO)、他のワーカーのキューは前から (FIFO) 盗む
+//!< (Each worker owns a queue, pops own queue from back (LIFO), steals from front of others (FIFO))
+//!< 依存ジョブが全て完了してからキューに積まれる (Job is queued after all dependencies have completed)
+class JobSystem
+{
+public:
+	class Job
+	{
+		friend class JobSystem;
+	public:
+		bool IsDone() const { return Done.load(std::memory_order_acquire); }
+	private:
+		std::function<void()> Function;
+		//!< 未完了の依存数 (+1 はスケジュール中の分) (Pending dependency count (+1 while scheduling))
+		std::atomic<uint32_t> Pending = 1;
+		std::atomic<bool> Done = false;
+		std::mutex Mutex;
+		//!< 自分の完了を待っているジョブ (Jobs waiting for this job)
+		std::vector<std::shared_ptr<Job>> Continuations;
+	};
+	using JobHandle = std::shared_ptr<Job>;
+
+	//!< ハードウェアスレッド数に合わせる、メインスレッドも Wait() 中にジョブを実行するので 1 つ減らす
+	//!< (Sized to hardware threads, minus one because main thread also runs jobs while in Wait())
+	JobSystem(const uint32_t WorkerCount = (std::max)(std::thread::hardware_concurrency(), 2u) - 1) : Queues(WorkerCount) {
+		Workers.reserve(WorkerCount);
+		for (uint32_t i = 0; i < WorkerCount; ++i) {
+			Workers.emplace_back([this, i] { WorkerMain(i); });
+		}
+	}
+	~JobSystem() {
+		{
+			std::lock_guard Lock(SleepMutex);
+			IsExit = true;
+		}
+		SleepCV.notify_all();
+		for (auto& i : Workers) { i.join(); }
+	}
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	//!< 共有インスタンス (Shared instance)
+	static JobSystem& Get() {
+		static JobSystem Instance;
+		return Instance;
+	}
+
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(std::size(Workers)); }
+
+	JobHandle Schedule(std::function<void()>&& Func, std::initializer_list<JobHandle> Dependencies = {}) {
+		return Schedule(std::move(Func), std::span<const JobHandle>(std::data(Dependencies), std::size(Dependencies)));
+	}
+	JobHandle Schedule(std::function<void()>&& Func, std::span<const JobHandle> Dependencies) {
+		auto J = std::make_shared<Job>();
+		J->Function = std::move(Func);
+		for (const auto& i : Dependencies) {
+			if (nullptr == i) { continue; }
+			std::lock_guard Lock(i->Mutex);
+			if (!i->IsDone()) {
+				J->Pending.fetch_add(1, std::memory_order_relaxed);
+				i->Continuations.emplace_back(J);
+			}
+		}
+		//!< スケジュール中の分を減らす、依存が全て完了済みならここでキューに積まれる (Release scheduling reference, queued here if all dependencies are done)
+		Release(J);
+		return J;
+	}
+
+	//!< 優先度の低いジョブ、ワーカーが暇な時にだけ実行され Wait() 中のスレッドは実行しない
+	//!< (Low priority job, run only by idle workers, never by a thread in Wait())
+	JobHandle ScheduleBackground(std::function<void()>&& Func) {
+		auto J = std::make_shared<Job>();
+		J->Function = std::move(Func);
+		J->Pending = 0;
+		{
+			std::lock_guard Lock(Background.Mutex);
+			Background.Jobs.emplace_back(J);
+		}
+		{
+			std::lock_guard Lock(SleepMutex);
+			++QueuedCount;
+		}
+		SleepCV.notify_one();
+		return J;
+	}
+
+	//!< 完了を待つ間、呼び出しスレッドもジョブを実行する (Calling thread also runs jobs while waiting)
+	void Wait(const JobHandle& J) {
+		while (nullptr != J && !J->IsDone()) {
+			if (!RunOne()) { std::this_thread::yield(); }
+		}
+	}
+	void Wait(std::span<const JobHandle> Js) {
+		for (const auto& i : Js) { Wait(i); }
+	}
+
+	//!< [0, Count) を分割して並列実行し、完了を待つ (Split [0, Count) into chunks, run in parallel and wait)
+	template<typename T>
+	void ParallelFor(const size_t Count, T&& Func, size_t ChunkSize = 0) {
+		if (0 == Count) { return; }
+		if (0 == ChunkSize) {
+			ChunkSize = (std::max)(Count / ((GetWorkerCount() + 1) * 4), size_t(1));
+		}
+		std::vector<JobHandle> Js;
+		Js.reserve(Count / ChunkSize + 1);
+		for (size_t i = 0; i < Count; i += ChunkSize) {
+			const auto End = (std::min)(i + ChunkSize, Count);
+			Js.emplace_back(Schedule([&Func, i, End] { for (auto j = i; j < End; ++j) { Func(j); } }));
+		}
+		Wait(Js);
+	}
+
+protected:
+	struct WorkQueue
+	{
+		std::mutex Mutex;
+		std::deque<JobHandle> Jobs;
+	};
+
+	void Release(const JobHandle& J) {
+		if (1 == J->Pending.fetch_sub(1, std::memory_order_acq_rel)) {
+			Enqueue(J);
+		}
+	}
+	void Enqueue(const JobHandle& J) {
+		//!< ワーカーからは自分のキューへ、それ以外からはラウンドロビンで積む (Worker pushes to own queue, others push round robin)
+		const auto Index = -1 != WorkerIndex ? static_cast<size_t>(WorkerIndex) : (NextQueue.fetch_add(1, std::memory_order_relaxed) % std::size(Queues));
+		{
+			std::lock_guard Lock(Queues[Index].Mutex);
+			Queues[Index].Jobs.emplace_back(J);
+		}
+		{
+			std::lock_guard Lock(SleepMutex);
+			++QueuedCount;
+		}
+		SleepCV.notify_one();
+	}
+	JobHandle Dequeue(const bool IncludeBackground) {
+		const auto Count = std::size(Queues);
+		if (-1 != WorkerIndex) {
+			auto& Q = Queues[WorkerIndex];
+			std::lock_guard Lock(Q.Mutex);
+			if (!std::empty(Q.Jobs)) {
+				auto J = std::move(Q.Jobs.back());
+				Q.Jobs.pop_back();
+				return J;
+			}
+		}
+		//!< 他のキューから盗む (Steal from other queues)
+		const auto Start = -1 != WorkerIndex ? static_cast<size_t>(WorkerIndex) + 1 : 0;
+		for (size_t i = 0; i < Count; ++i) {
+			auto& Q = Queues[(Start + i) % Count];
+			std::lock_guard Lock(Q.Mutex);
+			if (!std::empty(Q.Jobs)) {
+				auto J = std::move(Q.Jobs.front());
+				Q.Jobs.pop_front();
+				return J;
+			}
+		}
+		if (IncludeBackground) {
+			std::lock_guard Lock(Background.Mutex);
+			if (!std::empty(Background.Jobs)) {
+				auto J = std::move(Background.Jobs.front());
+				Background.Jobs.pop_front();
+				return J;
+			}
+		}
+		return nullptr;
+	}
+	bool RunOne(const bool IncludeBackground = false) {
+		auto J = Dequeue(IncludeBackground);
+		if (nullptr == J) { return false; }
+		{
+			std::lock_guard Lock(SleepMutex);
+			--QueuedCount;
+		}
+		Run(J);
+		return true;
+	}
+	void Run(const JobHandle& J) {
+		J->Function();
+		J->Function = nullptr;
+
+		std::vector<JobHandle> Continuations;
+		{
+			std::lock_guard Lock(J->Mutex);
+			J->Done.store(true, std::memory_order_release);
+			Continuations.swap(J->Continuations);
+		}
+		for (const auto& i : Continuations) { Release(i); }
+	}
+	void WorkerMain(const uint32_t Index) {
+		WorkerIndex = static_cast<int>(Index);
+		while (true) {
+			if (RunOne(true)) { continue; }
+			std::unique_lock Lock(SleepMutex);
+			SleepCV.wait(Lock, [this] { return IsExit || 0 < QueuedCount; });
+			if (IsExit) { break; }
+		}
+	}
+
+	std::vector<WorkQueue> Queues;
+	WorkQueue Background;
+	std::vector<std::thread> Workers;
+	std::atomic<uint32_t> NextQueue = 0;
+
+	std::mutex SleepMutex;
+	std::condition_variable SleepCV;
+	size_t QueuedCount = 0;
+	bool IsExit = false;
+
+	static inline thread_local int WorkerIndex = -1;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <cstddef>
+
+#ifdef _WIN64
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//!< 読み込み専用のメモリマップドファイル、コピーせずにファイル内容を参照する (Read only memory mapped file, access file contents without copy)
+class MappedFile
+{
+public:
+	MappedFile(const std::filesystem::path& Path) {
+#ifdef _WIN64
+		File = CreateFileW(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == File) { return; }
+		LARGE_INTEGER LI;
+		if (!GetFileSizeEx(File, &LI) || 0 == LI.QuadPart) { return; }
+		Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (nullptr == Mapping) { return; }
+		Data = static_cast<const std::byte*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (nullptr != Data) { Size = static_cast<size_t>(LI.QuadPart); }
+#else
+		File = open(Path.c_str(), O_RDONLY);
+		if (-1 == File) { return; }
+		struct stat ST;
+		if (-1 == fstat(File, &ST) || 0 == ST.st_size) { return; }
+		auto Ptr = mmap(nullptr, static_cast<size_t>(ST.st_size), PROT_READ, MAP_PRIVATE, File, 0);
+		if (MAP_FAILED == Ptr) { return; }
+		Data = static_cast<const std::byte*>(Ptr);
+		Size = static_cast<size_t>(ST.st_size);
+#endif
+	}
+	~MappedFile() {
+#ifdef _WIN64
+		if (nullptr != Data) { UnmapViewOfFile(Data); }
+		if (nullptr != Mapping) { CloseHandle(Mapping); }
+		if (INVALID_HANDLE_VALUE != File) { CloseHandle(File); }
+#else
+		if (nullptr != Data) { munmap(const_cast<std::byte*>(Data), Size); }
+		if (-1 != File) { close(File); }
+#endif
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool IsValid() const { return nullptr != Data; }
+	std::span<const std::byte> GetData() const { return std::span<const std::byte>(Data, Size); }
+
+private:
+#ifdef _WIN64
+	HANDLE File = INVALID_HANDLE_VALUE;
+	HANDLE Mapping = nullptr;
+#else
+	int File = -1;
+#endif
+	const std::byte* Data = nullptr;
+	size_t Size = 0;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+//!< 単一生産者、単一消費者のロックフリーリングバッファ (Single producer, single consumer lock free ring buffer)
+//!< 要素は確保したまま再利用するので、生産者は BeginPush() で得た要素へ直接書き込む (Elements are kept and reused, producer writes directly into element from BeginPush())
+template<typename T, size_t N>
+class SPSCRing
+{
+	static_assert(2 <= N && 0 == (N & (N - 1)), "N must be power of two");
+public:
+	//!< [生産者] 空きが無ければ nullptr (Producer, nullptr if full)
+	T* BeginPush() {
+		const auto H = Head.load(std::memory_order_relaxed);
+		if (N == H - Tail.load(std::memory_order_acquire)) { return nullptr; }
+		return &Items[H & (N - 1)];
+	}
+	void EndPush() { Head.store(Head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+	//!< [消費者] 先頭から Index 番目、無ければ nullptr (Consumer, Index-th from front, nullptr if not exist)
+	size_t GetSize() const { return Head.load(std::memory_order_acquire) - Tail.load(std::memory_order_relaxed); }
+	T* Peek(const size_t Index = 0) {
+		if (Index >= GetSize()) { return nullptr; }
+		return &Items[(Tail.load(std::memory_order_relaxed) + Index) & (N - 1)];
+	}
+	void Pop() { Tail.store(Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+private:
+	std::array<T, N> Items;
+	//!< 生産者と消費者で別のキャッシュラインにする (Separate cache lines for producer and consumer)
+	alignas(64) std::atomic<size_t> Head = 0;
+	alignas(64) std::atomic<size_t> Tail = 0;
+};
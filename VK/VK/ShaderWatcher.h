@@ -0,0 +1,119 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+#include <shaderc/shaderc.hpp>
+
+//!< シェーダのソースを監視し、変更されたら別スレッドで SPIR-V へコンパイルする (Watch shader sources, compile to SPIR-V on separate thread when changed)
+//!< glsl_compile と同じく ソース名 + .spv へ書き出すので、CreateShaderModule() はファイルの方を読み込む
+//!< (Written to source name + .spv as glsl_compile does, so CreateShaderModule() loads the file)
+class ShaderWatcher
+{
+public:
+	ShaderWatcher(const std::filesystem::path& Dir, const std::chrono::milliseconds Interval = std::chrono::milliseconds(500)) : Directory(Dir) {
+		//!< 開始時点のファイルはコンパイル済みとみなし、更新時刻だけ記録する (Files at start are treated as compiled, only record write time)
+		Poll(false);
+		Thread = std::thread([this, Interval] {
+			std::unique_lock Lock(Mutex);
+			while (!CV.wait_for(Lock, Interval, [this] { return IsExit; })) {
+				Lock.unlock();
+				Poll(true);
+				Lock.lock();
+			}
+		});
+	}
+	~ShaderWatcher() {
+		{
+			std::lock_guard Lock(Mutex);
+			IsExit = true;
+		}
+		CV.notify_all();
+		Thread.join();
+	}
+	ShaderWatcher(const ShaderWatcher&) = delete;
+	ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+	//!< 前回の呼び出し以降にコンパイルに成功したシェーダがあれば true (True if any shader has been compiled since last call)
+	bool ConsumeChanged() { return IsChanged.exchange(false, std::memory_order_acq_rel); }
+
+protected:
+	static bool GetKind(const std::filesystem::path& Path, shaderc_shader_kind& Kind) {
+		static const std::map<std::filesystem::path, shaderc_shader_kind> Kinds = {
+			{ ".vert", shaderc_vertex_shader },
+			{ ".frag", shaderc_fragment_shader },
+			{ ".tese", shaderc_tess_evaluation_shader },
+			{ ".tesc", shaderc_tess_control_shader },
+			{ ".geom", shaderc_geometry_shader },
+			{ ".comp", shaderc_compute_shader },
+		};
+		if (const auto It = Kinds.find(Path.extension()); std::end(Kinds) != It) {
+			Kind = It->second;
+			return true;
+		}
+		return false;
+	}
+	void Poll(const bool Compile) {
+		std::error_code EC;
+		auto Compiled = false;
+		for (const auto& i : std::filesystem::directory_iterator(Directory, EC)) {
+			shaderc_shader_kind Kind;
+			if (!i.is_regular_file(EC) || !GetKind(i.path(), Kind)) { continue; }
+			const auto Time = std::filesystem::last_write_time(i.path(), EC);
+			if (EC) { continue; }
+			auto& Last = WriteTimes[i.path()];
+			if (Last == Time) { continue; }
+			Last = Time;
+			if (Compile && CompileToFile(i.path(), Kind)) {
+				Compiled = true;
+			}
+		}
+		if (Compiled) {
+			IsChanged.store(true, std::memory_order_release);
+		}
+	}
+	//!< glsl_compile と同じオプション (-V --target-env vulkan1.3 -g -Od) (Same options as glsl_compile)
+	bool CompileToFile(const std::filesystem::path& Path, const shaderc_shader_kind Kind) {
+		std::ifstream In(Path);
+		if (In.fail()) { return false; }
+		std::stringstream SS;
+		SS << In.rdbuf();
+
+		shaderc::CompileOptions Options;
+		Options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3);
+		Options.SetGenerateDebugInfo();
+		Options.SetOptimizationLevel(shaderc_optimization_level_zero);
+		const auto Result = Compiler.CompileGlslToSpv(SS.str(), Kind, Path.string().c_str(), Options);
+		if (shaderc_compilation_status_success != Result.GetCompilationStatus()) {
+			//!< 失敗した場合は以前の .spv を残す (Keep previous .spv on failure)
+			std::cerr << Result.GetErrorMessage();
+			return false;
+		}
+
+		auto SpvPath = Path;
+		SpvPath += ".spv";
+		std::ofstream Out(SpvPath, std::ios::binary | std::ios::trunc);
+		if (Out.fail()) { return false; }
+		Out.write(reinterpret_cast<const char*>(Result.cbegin()), std::distance(Result.cbegin(), Result.cend()) * sizeof(uint32_t));
+		std::cout << "Shader reloaded : " << SpvPath.string() << std::endl;
+		return !Out.fail();
+	}
+
+	std::filesystem::path Directory;
+	std::map<std::filesystem::path, std::filesystem::file_time_type> WriteTimes;
+	shaderc::Compiler Compiler;
+	std::atomic<bool> IsChanged = false;
+
+	std::thread Thread;
+	std::mutex Mutex;
+	std::condition_variable CV;
+	bool IsExit = false;
+};
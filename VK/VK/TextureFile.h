@@ -0,0 +1,242 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+
+#include "MappedFile.h"
+
+//!< DDS, KTX (1.1) をメモリマップし、ヘッダのみを解析する、ペイロードはコピーせずにマップされたまま参照する
+//!< (Memory map DDS, KTX (1.1) and parse header only, payload is referenced as mapped without copy)
+//!< 解析できない場合 (ビットマスク指定の DDS、行にパディングのある KTX 等) は IsValid() が false になるので gli::load() を使う
+//!< (If not parsable (bitmask DDS, KTX with row padding etc.), IsValid() is false, so use gli::load())
+class TextureFile
+{
+public:
+	//!< レイヤはキューブの面を含む (レイヤ * 6 + 面) (Layer includes cube face (layer * 6 + face))
+	struct Region
+	{
+		size_t Offset;
+		size_t Size;
+		uint32_t Level;
+		uint32_t Layer;
+		gli::extent3d Extent;
+	};
+
+	TextureFile(const std::filesystem::path& Path) : File(Path) {
+		if (!File.IsValid()) { return; }
+		const auto Data = File.GetData();
+		if (!ParseDDS(Data) && !ParseKTX(Data)) {
+			Regions.clear();
+		}
+	}
+	TextureFile(const TextureFile&) = delete;
+	TextureFile& operator=(const TextureFile&) = delete;
+
+	bool IsValid() const { return !std::empty(Regions); }
+
+	gli::format GetFormat() const { return Format; }
+	gli::target GetTarget() const { return Target; }
+	gli::extent3d GetExtent() const { return Extent; }
+	uint32_t GetLevels() const { return Levels; }
+	uint32_t GetLayers() const { return Layers * Faces; }
+	uint32_t GetFaces() const { return Faces; }
+	const std::vector<Region>& GetRegions() const { return Regions; }
+	std::span<const std::byte> GetData() const { return File.GetData(); }
+
+	//!< 全領域のサイズ (Total size of regions)
+	size_t GetSize() const {
+		size_t Size = 0;
+		for (const auto& i : Regions) { Size += i.Size; }
+		return Size;
+	}
+
+protected:
+	template<typename T> static bool Read(std::span<const std::byte> Data, const size_t Offset, T& Out) {
+		if (Offset + sizeof(T) > std::size(Data)) { return false; }
+		std::memcpy(&Out, std::data(Data) + Offset, sizeof(T));
+		return true;
+	}
+	gli::extent3d GetLevelExtent(const uint32_t Level) const {
+		return (glm::max)(Extent >> static_cast<int>(Level), gli::extent3d(1));
+	}
+	size_t GetLevelSize(const uint32_t Level) const {
+		const auto BE = gli::block_extent(Format);
+		const auto Blocks = (GetLevelExtent(Level) + BE - 1) / BE;
+		return static_cast<size_t>(Blocks.x) * Blocks.y * Blocks.z * gli::block_size(Format);
+	}
+	//!< ヘッダの値はそのまま信用しない (Values in header are not trusted as is)
+	//!< 大きさは 1 - MaxDimension、レベル数はフルミップチェインまでに制限し、レイヤ数はデータに収まらないものを弾く
+	//!< (Extent is limited to 1 - MaxDimension, level count up to full mip chain, layer count which does not fit in data is rejected)
+	static constexpr int MaxDimension = 1 << 16;
+	bool ValidateHeader(std::span<const std::byte> Data, const size_t Offset) {
+		if (Extent.x < 1 || Extent.y < 1 || Extent.z < 1 || Extent.x > MaxDimension || Extent.y > MaxDimension || Extent.z > MaxDimension) { return false; }
+		Levels = (std::min)(Levels, static_cast<uint32_t>(std::bit_width(static_cast<uint32_t>((std::max)({ Extent.x, Extent.y, Extent.z })))));
+		if (Offset > std::size(Data)) { return false; }
+		size_t LayerSize = 0;
+		for (uint32_t i = 0; i < Levels; ++i) { LayerSize += GetLevelSize(i); }
+		return static_cast<uint64_t>(Layers) * Faces <= (std::size(Data) - Offset) / LayerSize;
+	}
+	//!< 範囲外のものは追加せずに false を返す (Returns false without adding if out of range)
+	bool AddRegion(std::span<const std::byte> Data, const size_t Offset, const uint32_t Level, const uint32_t Layer) {
+		const auto Size = GetLevelSize(Level);
+		if (Offset > std::size(Data) || Size > std::size(Data) - Offset) { return false; }
+		Regions.emplace_back(Region({ .Offset = Offset, .Size = Size, .Level = Level, .Layer = Layer, .Extent = GetLevelExtent(Level) }));
+		return true;
+	}
+
+	struct DDS_PIXELFORMAT
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t FourCC;
+		uint32_t RGBBitCount;
+		uint32_t Masks[4];
+	};
+	struct DDS_HEADER
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t Height;
+		uint32_t Width;
+		uint32_t PitchOrLinearSize;
+		uint32_t Depth;
+		uint32_t MipMapCount;
+		uint32_t Reserved1[11];
+		DDS_PIXELFORMAT PixelFormat;
+		uint32_t Caps[4];
+		uint32_t Reserved2;
+	};
+	struct DDS_HEADER_DXT10
+	{
+		uint32_t DXGIFormat;
+		uint32_t ResourceDimension;
+		uint32_t MiscFlag;
+		uint32_t ArraySize;
+		uint32_t MiscFlags2;
+	};
+	bool ParseDDS(std::span<const std::byte> Data) {
+		constexpr uint32_t DDSMagic = 0x20534444; //!< 'DDS '
+		uint32_t Magic;
+		if (!Read(Data, 0, Magic) || DDSMagic != Magic) { return false; }
+		DDS_HEADER Header;
+		if (!Read(Data, sizeof(Magic), Header) || sizeof(Header) != Header.Size) { return false; }
+		auto Offset = sizeof(Magic) + sizeof(Header);
+
+		//!< ビットマスク指定のものは gli に任せる (Leave bitmask ones to gli)
+		constexpr uint32_t DDPF_FOURCC = 0x4;
+		if (!(Header.PixelFormat.Flags & DDPF_FOURCC)) { return false; }
+
+		const gli::dx DX;
+		const auto FourCC = static_cast<gli::dx::d3dfmt>(Header.PixelFormat.FourCC);
+		Extent = gli::extent3d(Header.Width, (std::max)(Header.Height, 1u), (std::max)(Header.Depth, 1u));
+		Levels = (std::max)(Header.MipMapCount, 1u);
+		if (gli::dx::D3DFMT_DX10 == FourCC) {
+			DDS_HEADER_DXT10 Header10;
+			if (!Read(Data, Offset, Header10)) { return false; }
+			Offset += sizeof(Header10);
+
+			Format = DX.find(FourCC, gli::dx::dxgiFormat(static_cast<gli::dx::dxgi_format_dds>(Header10.DXGIFormat)));
+			Layers = (std::max)(Header10.ArraySize, 1u);
+			//!< D3D10_RESOURCE_MISC_TEXTURECUBE
+			Faces = (Header10.MiscFlag & 0x4) ? 6 : 1;
+			//!< D3D10_RESOURCE_DIMENSION_TEXTURE1D, 2D, 3D
+			switch (Header10.ResourceDimension) {
+			case 2: Target = Layers > 1 ? gli::TARGET_1D_ARRAY : gli::TARGET_1D; break;
+			case 3: Target = 6 == Faces ? (Layers > 1 ? gli::TARGET_CUBE_ARRAY : gli::TARGET_CUBE) : (Layers > 1 ? gli::TARGET_2D_ARRAY : gli::TARGET_2D); break;
+			case 4: Target = gli::TARGET_3D; break;
+			default: return false;
+			}
+		}
+		else {
+			Format = DX.find(FourCC);
+			Layers = 1;
+			//!< DDSCAPS2_CUBEMAP (全ての面があるもののみ) (All faces only)
+			Faces = 0xfe00 == (Header.Caps[1] & 0xfe00) ? 6 : 1;
+			//!< DDSCAPS2_VOLUME
+			Target = 6 == Faces ? gli::TARGET_CUBE : ((Header.Caps[1] & 0x200000) ? gli::TARGET_3D : gli::TARGET_2D);
+		}
+		if (gli::FORMAT_UNDEFINED == Format || !gli::is_valid(Format)) { return false; }
+		if (!ValidateHeader(Data, Offset)) { return false; }
+
+		//!< レイヤ、面、レベルの順に詰まっている (Tightly packed in layer, face, level order)
+		for (uint32_t i = 0; i < Layers * Faces; ++i) {
+			for (uint32_t j = 0; j < Levels; ++j) {
+				if (!AddRegion(Data, Offset, j, i)) { return false; }
+				Offset += Regions.back().Size;
+			}
+		}
+		return true;
+	}
+
+	struct KTX_HEADER
+	{
+		uint8_t Identifier[12];
+		uint32_t Endianness;
+		uint32_t GLType;
+		uint32_t GLTypeSize;
+		uint32_t GLFormat;
+		uint32_t GLInternalFormat;
+		uint32_t GLBaseInternalFormat;
+		uint32_t PixelWidth;
+		uint32_t PixelHeight;
+		uint32_t PixelDepth;
+		uint32_t NumberOfArrayElements;
+		uint32_t NumberOfFaces;
+		uint32_t NumberOfMipmapLevels;
+		uint32_t BytesOfKeyValueData;
+	};
+	bool ParseKTX(std::span<const std::byte> Data) {
+		constexpr uint8_t Identifier[] = { 0xab, 'K', 'T', 'X', ' ', '1', '1', 0xbb, '\r', '\n', 0x1a, '\n' };
+		KTX_HEADER Header;
+		if (!Read(Data, 0, Header) || 0 != std::memcmp(Header.Identifier, Identifier, sizeof(Identifier))) { return false; }
+		//!< エンディアンが異なるものは扱わない (Different endianness is not handled)
+		if (0x04030201 != Header.Endianness) { return false; }
+
+		const gli::gl GL(gli::gl::PROFILE_KTX);
+		Format = GL.find(static_cast<gli::gl::internal_format>(Header.GLInternalFormat), static_cast<gli::gl::external_format>(Header.GLFormat), static_cast<gli::gl::type_format>(Header.GLType));
+		if (gli::FORMAT_UNDEFINED == Format || !gli::is_valid(Format)) { return false; }
+
+		Extent = gli::extent3d(Header.PixelWidth, (std::max)(Header.PixelHeight, 1u), (std::max)(Header.PixelDepth, 1u));
+		Levels = (std::max)(Header.NumberOfMipmapLevels, 1u);
+		Layers = (std::max)(Header.NumberOfArrayElements, 1u);
+		Faces = 6 == Header.NumberOfFaces ? 6 : 1;
+		const auto IsArray = 0 != Header.NumberOfArrayElements;
+		if (6 == Faces) { Target = IsArray ? gli::TARGET_CUBE_ARRAY : gli::TARGET_CUBE; }
+		else if (Header.PixelDepth > 1) { Target = gli::TARGET_3D; }
+		else if (0 == Header.PixelHeight) { Target = IsArray ? gli::TARGET_1D_ARRAY : gli::TARGET_1D; }
+		else { Target = IsArray ? gli::TARGET_2D_ARRAY : gli::TARGET_2D; }
+
+		auto Offset = sizeof(Header) + static_cast<size_t>(Header.BytesOfKeyValueData);
+		if (!ValidateHeader(Data, Offset)) { return false; }
+
+		//!< 非圧縮の行は 4 バイトにパディングされるので、パディングの無いもののみ扱う (Uncompressed rows are padded to 4 bytes, so handle only unpadded ones)
+		if (!gli::is_compressed(Format)) {
+			for (uint32_t i = 0; i < Levels; ++i) {
+				const auto LE = GetLevelExtent(i);
+				if (LE.y > 1 && 0 != (LE.x * gli::block_size(Format)) % 4) { return false; }
+			}
+		}
+
+		//!< レベル毎に imageSize (uint32_t) が先行し、レイヤ、面の順に 4 バイト境界で並ぶ (imageSize (uint32_t) precedes each level, then layers, faces aligned to 4 bytes)
+		for (uint32_t i = 0; i < Levels; ++i) {
+			Offset += sizeof(uint32_t);
+			for (uint32_t j = 0; j < Layers * Faces; ++j) {
+				if (!AddRegion(Data, Offset, i, j)) { return false; }
+				Offset += (Regions.back().Size + 3) & ~size_t(3);
+			}
+		}
+		return true;
+	}
+
+	MappedFile File;
+	gli::format Format = gli::FORMAT_UNDEFINED;
+	gli::target Target = gli::TARGET_2D;
+	gli::extent3d Extent = gli::extent3d(0);
+	uint32_t Levels = 0;
+	uint32_t Layers = 0;
+	uint32_t Faces = 0;
+	std::vector<Region> Regions;
+};
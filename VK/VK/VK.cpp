@@ -4,12 +4,28 @@
 #include <fstream>
 #include <map>
 #include <bitset>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <iomanip>
+#include <bit>
 
 #include "VK.h"
+#include "MappedFile.h"
+#include "TextureFile.h"
+#include "BlockDecoder.h"
 
 VK::~VK() 
 {
-	//!< ̊҂ (Wait for idle)
+	//!< Shutdown() が呼ばれていない場合 (When Shutdown() has not been called)
+	Shutdown();
+
+#ifdef USE_SHADER_HOT_RELOAD
+	ShaderWatch.reset();
+#endif
+
+	//!< 処理の完了を待つ (Wait for idle)
 	if (VK_NULL_HANDLE != Device) {
 		VERIFY_SUCCEEDED(vkDeviceWaitIdle(Device));
 	}
@@ -17,6 +33,13 @@ VK::~VK()
 		//vkFreeDescriptorSets(Device, i, static_cast<uint32_t>(std::size(DescriptorSets)), std::data(DescriptorSets));
 		vkDestroyDescriptorPool(Device, i, nullptr);
 	}
+	if (VK_NULL_HANDLE != Bindless.DescriptorPool) {
+		vkDestroyDescriptorPool(Device, Bindless.DescriptorPool, nullptr);
+	}
+	DescriptorSetAllocator.Destroy();
+	for (const auto& i : DescriptorUpdateTemplates) {
+		vkDestroyDescriptorUpdateTemplate(Device, i.second, nullptr);
+	}
 
 	for (auto i : Framebuffers) {
 		vkDestroyFramebuffer(Device, i, nullptr);
@@ -24,26 +47,48 @@ VK::~VK()
 	for (auto i : Pipelines) {
 		vkDestroyPipeline(Device, i, nullptr);
 	}
+	for (auto i : RecreatedPipelines) {
+		vkDestroyPipeline(Device, i, nullptr);
+	}
+	//!< バックグラウンドのリンク完了を待ってから破棄する (Wait for background links before destroy)
+	JobSystem::Get().Wait(PipelineLinkJobs);
+	for (const auto& i : OptimizedPipelines) {
+		vkDestroyPipeline(Device, i.second, nullptr);
+	}
+	if (VK_NULL_HANDLE != PipelineCache) {
+		vkDestroyPipelineCache(Device, PipelineCache, nullptr);
+	}
 	for (auto i : RenderPasses) {
+		EvictPipelineLibraries(VK_NULL_HANDLE, i);
 		vkDestroyRenderPass(Device, i, nullptr);
 	}
 	for (auto i : PipelineLayouts) {
+		EvictPipelineLibraries(i, VK_NULL_HANDLE);
 		vkDestroyPipelineLayout(Device, i, nullptr);
 	}
+	//!< 残り (頂点入力等) (Rest (vertex input etc.))
+	for (const auto& i : PipelineLibraries) {
+		vkDestroyPipeline(Device, i.second.Pipeline, nullptr);
+	}
 	for (auto i : DescriptorSetLayouts) {
 		vkDestroyDescriptorSetLayout(Device, i, nullptr);
 	}
+	if (VK_NULL_HANDLE != Bindless.DescriptorSetLayout) {
+		vkDestroyDescriptorSetLayout(Device, Bindless.DescriptorSetLayout, nullptr);
+	}
 	for (auto i : Samplers) {
 		vkDestroySampler(Device, i, nullptr);
 	}
-	for (auto i : Textures) {
-		for (auto j : i.Staging) {
-			vkFreeMemory(Device, j.second, nullptr);
-			vkDestroyBuffer(Device, j.first, nullptr);
-		}
-		vkFreeMemory(Device, i.DeviceMemory, nullptr);
-		vkDestroyImageView(Device, i.ImageView.second, nullptr);
-		vkDestroyImage(Device, i.ImageView.first, nullptr);
+	for (auto& i : Textures) {
+		DestroyTexture(i);
+	}
+	for (auto& i : TextureUploads) {
+		DestroyTexture(i.Tex);
+		vkDestroyCommandPool(Device, i.CommandPool, nullptr);
+	}
+	for (auto i : StorageBuffers) {
+		vkFreeMemory(Device, i.second, nullptr);
+		vkDestroyBuffer(Device, i.first, nullptr);
 	}
 	for (auto i : UniformBuffers) {
 		vkFreeMemory(Device, i.second, nullptr);
@@ -61,6 +106,9 @@ VK::~VK()
 		vkFreeMemory(Device, i.second, nullptr);
 		vkDestroyBuffer(Device, i.first, nullptr);
 	}
+	for (auto& i : TransferCommandBuffers) {
+		vkDestroyCommandPool(Device, i.first, nullptr);
+	}
 	for (auto& i : SecondaryCommandBuffers) {
 		vkDestroyCommandPool(Device, i.first, nullptr);
 	}
@@ -73,6 +121,9 @@ VK::~VK()
 	if (VK_NULL_HANDLE != Swapchain.VkSwapchain) {
 		vkDestroySwapchainKHR(Device, Swapchain.VkSwapchain, nullptr);
 	}
+	if (VK_NULL_HANDLE != UploadSemaphore) {
+		vkDestroySemaphore(Device, UploadSemaphore, nullptr);
+	}
 	if (VK_NULL_HANDLE != RenderFinishedSemaphore) {
 		vkDestroySemaphore(Device, RenderFinishedSemaphore, nullptr);
 	}
@@ -98,6 +149,27 @@ VK::~VK()
 	}
 }
 
+void VK::LogInitStages()
+{
+	std::lock_guard Lock(InitStageMutex);
+	std::ranges::sort(InitStages, [](const auto& lhs, const auto& rhs) { return lhs.Begin < rhs.Begin; });
+
+	const auto ToMS = [](const auto& rhs) { return std::chrono::duration<float, std::milli>(rhs).count(); };
+	std::cout << "Init stages (ms)" << std::endl;
+	for (const auto& i : InitStages) {
+		std::cout << "\t" << std::setw(24) << std::left << i.Name << std::right
+			<< std::fixed << std::setprecision(2)
+			<< " [" << std::setw(8) << ToMS(i.Begin - InitBegin) << " - " << std::setw(8) << ToMS(i.End - InitBegin) << "] "
+			<< std::setw(8) << ToMS(i.End - i.Begin)
+			<< " (Thread " << i.ThreadID << ")" << std::endl;
+	}
+	if (!std::empty(InitStages)) {
+		const auto End = std::ranges::max(InitStages, {}, &InitStage::End).End;
+		std::cout << "\tTotal " << ToMS(End - InitBegin) << std::endl;
+	}
+	std::cout << std::defaultfloat;
+}
+
 void VK::SelectPhysicalDevice() 
 {
 	std::vector<VkPhysicalDevice> PhysicalDevices;
@@ -106,7 +178,7 @@ void VK::SelectPhysicalDevice()
 	PhysicalDevices.resize(Count);
 	VERIFY_SUCCEEDED(vkEnumeratePhysicalDevices(Instance, &Count, std::data(PhysicalDevices)));
 
-	//!< ł͍ő僁̕foCX̗p (Select max memory GPU here)
+	//!< ここでは最大メモリの物理デバイスを採用する (Select max memory GPU here)
 	SelectedPhysDevice.first = *std::ranges::max_element(PhysicalDevices, [](const auto& lhs, const auto& rhs) {
 		VkPhysicalDeviceMemoryProperties MemPropL, MemPropR;
 		vkGetPhysicalDeviceMemoryProperties(lhs, &MemPropL);
@@ -116,9 +188,9 @@ void VK::SelectPhysicalDevice()
 		return MemTotalL < MemTotalR;
 		});
 
-	//!< foCXvpeBoĂ (Remember device properties)
+	//!< デバイスプロパティを覚えておく (Remember device properties)
 	vkGetPhysicalDeviceProperties(SelectedPhysDevice.first, &SelectedPhysDevice.second.PDP);
-	//!< vpeBoĂ (Remember memory properties)
+	//!< メモリプロパティを覚えておく (Remember memory properties)
 	vkGetPhysicalDeviceMemoryProperties(SelectedPhysDevice.first, &SelectedPhysDevice.second.PDMP);
 #ifdef _DEBUG
 	std::cout << SelectedPhysDevice.second.PDP.deviceName << "is selected" << std::endl;
@@ -132,7 +204,7 @@ void VK::SelectSurfaceFormat()
 	std::vector<VkSurfaceFormatKHR> SFs(Count);
 	VERIFY_SUCCEEDED(vkGetPhysicalDeviceSurfaceFormatsKHR(SelectedPhysDevice.first, Surface, &Count, std::data(SFs)));
 
-	//!< ł͍ŏɌ FORMAT_UNDEFINED łȂ̗̂p (Select first no FORMAT_UNDEFINED here)
+	//!< ここでは最初に見つかった FORMAT_UNDEFINED でないものを採用する (Select first no FORMAT_UNDEFINED here)
 	SelectedSurfaceFormat = *std::ranges::find_if(SFs, [](const auto& rhs) {
 		if (VK_FORMAT_UNDEFINED != rhs.format) {
 			return true;
@@ -143,7 +215,7 @@ void VK::SelectSurfaceFormat()
 
 void VK::CreateDevice()
 {
-	//!< foCX쐬OɁAL[擾 (Before create device, get queue information)
+	//!< デバイス作成前に、キュー情報取得 (Before create device, get queue information)
 	using FamilyIndexAndPriorities = std::map<uint32_t, std::vector<float>>;
 	FamilyIndexAndPriorities FIAP;
 	uint32_t GraphicsIndexInFamily;
@@ -155,7 +227,7 @@ void VK::CreateDevice()
 		QFPs.resize(Count);
 		vkGetPhysicalDeviceQueueFamilyProperties(SelectedPhysDevice.first, &Count, std::data(QFPs));
 
-		//!< @\L[t@~CfbNX𗧂Ă (If queue family index has function, set bit)
+		//!< 機能を持つキューファミリインデックスを立てる (If queue family index has function, set bit)
 		std::bitset<32> GraphicsMask;
 		std::bitset<32> PresentMask;
 		for (size_t i = 0; i < std::size(QFPs); ++i) {
@@ -170,7 +242,7 @@ void VK::CreateDevice()
 			}
 		}
 
-		//!< ł͋@\ŏ̃t@~CfbNX̗p (Select first family index, which has function)
+		//!< ここでは機能を持つ最初のファミリインデックスを採用する (Select first family index, which has function)
 		GraphicsQueue.second = [&]() {
 			for (uint32_t i = 0; i < std::size(GraphicsMask); ++i) {
 				if (GraphicsMask.test(i)) {
@@ -188,14 +260,14 @@ void VK::CreateDevice()
 			return (std::numeric_limits<uint32_t>::max)();
 			}();
 
-		//!< (L[t@~CfbNX) vCIeBǉAt@~ł̃CfbNX͈UoĂ (For each queue family index, add priority)
+		//!< (キューファミリインデックス毎に) プライオリティを追加、ファミリ内でのインデックスは一旦覚えておく (For each queue family index, add priority)
 		GraphicsIndexInFamily = static_cast<uint32_t>(std::size(FIAP[GraphicsQueue.second]));
 		FIAP[GraphicsQueue.second].emplace_back(0.5f);
 		PresentIndexInFamily = static_cast<uint32_t>(std::size(FIAP[PresentQueue.second]));
 		FIAP[PresentQueue.second].emplace_back(0.5f);
 	}
 
-	//!< foCX쐬 (Create device)
+	//!< デバイス作成 (Create device)
 	{
 		std::vector<VkDeviceQueueCreateInfo> DQCIs;
 		for (const auto& i : FIAP) {
@@ -207,9 +279,68 @@ void VK::CreateDevice()
 								.queueCount = static_cast<uint32_t>(std::size(i.second)), .pQueuePriorities = std::data(i.second)
 				}));
 		}
-		const std::array Extensions = {
+		std::vector Extensions = {
 			VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 		};
+
+		//!< デバイスがサポートする拡張を取得 (Get extensions supported by device)
+		std::vector<VkExtensionProperties> EPs;
+		{
+			uint32_t Count = 0;
+			VERIFY_SUCCEEDED(vkEnumerateDeviceExtensionProperties(SelectedPhysDevice.first, nullptr, &Count, nullptr));
+			EPs.resize(Count);
+			VERIFY_SUCCEEDED(vkEnumerateDeviceExtensionProperties(SelectedPhysDevice.first, nullptr, &Count, std::data(EPs)));
+		}
+		const auto HasExtension = [&](std::string_view Name) {
+			return std::ranges::any_of(EPs, [&](const auto& rhs) { return Name == rhs.extensionName; });
+		};
+
+		//!< プッシュデスクリプタ (Push descriptor)
+		HasPushDescriptor = HasExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+		if (HasPushDescriptor) {
+			Extensions.emplace_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+		}
+
+		//!< デバイスがサポートする機能を取得 (Get features supported by device)
+		//!< 拡張の機能構造体はサポートされている場合のみチェインする (Chain extension feature structures only if supported)
+		void* SupportedNext = nullptr;
+		const auto HasGPLExtension = HasExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) && HasExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT SupportedPDGPLF = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT, .pNext = nullptr };
+		if (HasGPLExtension) { SupportedPDGPLF.pNext = SupportedNext; SupportedNext = &SupportedPDGPLF; }
+		const auto HasEDS3Extension = HasExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT SupportedPDEDS3F = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT, .pNext = nullptr };
+		if (HasEDS3Extension) { SupportedPDEDS3F.pNext = SupportedNext; SupportedNext = &SupportedPDEDS3F; }
+		VkPhysicalDeviceVulkan12Features SupportedPDV12F = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, .pNext = SupportedNext };
+		VkPhysicalDeviceFeatures2 SupportedPDF2 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, .pNext = &SupportedPDV12F };
+		vkGetPhysicalDeviceFeatures2(SelectedPhysDevice.first, &SupportedPDF2);
+
+		//!< グラフィックスパイプラインライブラリ (Graphics pipeline library)
+		HasGraphicsPipelineLibrary = HasGPLExtension && SupportedPDGPLF.graphicsPipelineLibrary;
+		if (HasGraphicsPipelineLibrary) {
+			Extensions.emplace_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+			Extensions.emplace_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+		}
+
+		//!< 拡張ダイナミックステート 1, 2 は 1.3 のコア、ポリゴンモードは 3 が必要 (Extended dynamic state 1, 2 are core in 1.3, polygon mode requires 3)
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+		HasDynamicPolygonMode = HasEDS3Extension && SupportedPDEDS3F.extendedDynamicState3PolygonMode;
+		if (HasDynamicPolygonMode) {
+			Extensions.emplace_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+		}
+#endif
+
+		//!< バインドレスに必要な機能 (Features required for bindless)
+		HasBindless = SupportedPDV12F.descriptorIndexing
+			&& SupportedPDV12F.runtimeDescriptorArray
+			&& SupportedPDV12F.descriptorBindingPartiallyBound
+			&& SupportedPDV12F.descriptorBindingVariableDescriptorCount
+			&& SupportedPDV12F.descriptorBindingUpdateUnusedWhilePending
+			&& SupportedPDV12F.descriptorBindingSampledImageUpdateAfterBind
+			&& SupportedPDV12F.descriptorBindingStorageBufferUpdateAfterBind
+			&& SupportedPDV12F.shaderSampledImageArrayNonUniformIndexing
+			&& SupportedPDV12F.shaderStorageBufferArrayNonUniformIndexing;
+		const VkBool32 BL = HasBindless ? VK_TRUE : VK_FALSE;
+
 		VkPhysicalDeviceVulkan11Features PDV11F = {
 			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES,
 			.pNext = nullptr,
@@ -238,27 +369,27 @@ void VK::CreateDevice()
 			.shaderSharedInt64Atomics = VK_FALSE,
 			.shaderFloat16 = VK_FALSE,
 			.shaderInt8 = VK_FALSE,
-			.descriptorIndexing = VK_FALSE,
+			.descriptorIndexing = BL,
 			.shaderInputAttachmentArrayDynamicIndexing = VK_FALSE,
 			.shaderUniformTexelBufferArrayDynamicIndexing = VK_FALSE,
 			.shaderStorageTexelBufferArrayDynamicIndexing = VK_FALSE,
 			.shaderUniformBufferArrayNonUniformIndexing = VK_FALSE,
-			.shaderSampledImageArrayNonUniformIndexing = VK_FALSE,
-			.shaderStorageBufferArrayNonUniformIndexing = VK_FALSE,
+			.shaderSampledImageArrayNonUniformIndexing = BL,
+			.shaderStorageBufferArrayNonUniformIndexing = BL,
 			.shaderStorageImageArrayNonUniformIndexing = VK_FALSE,
 			.shaderInputAttachmentArrayNonUniformIndexing = VK_FALSE,
 			.shaderUniformTexelBufferArrayNonUniformIndexing = VK_FALSE,
 			.shaderStorageTexelBufferArrayNonUniformIndexing = VK_FALSE,
 			.descriptorBindingUniformBufferUpdateAfterBind = VK_FALSE,
-			.descriptorBindingSampledImageUpdateAfterBind = VK_FALSE,
+			.descriptorBindingSampledImageUpdateAfterBind = BL,
 			.descriptorBindingStorageImageUpdateAfterBind = VK_FALSE,
-			.descriptorBindingStorageBufferUpdateAfterBind = VK_FALSE,
+			.descriptorBindingStorageBufferUpdateAfterBind = BL,
 			.descriptorBindingUniformTexelBufferUpdateAfterBind = VK_FALSE,
 			.descriptorBindingStorageTexelBufferUpdateAfterBind = VK_FALSE,
-			.descriptorBindingUpdateUnusedWhilePending = VK_FALSE,
-			.descriptorBindingPartiallyBound = VK_FALSE,
-			.descriptorBindingVariableDescriptorCount = VK_FALSE,
-			.runtimeDescriptorArray = VK_FALSE,
+			.descriptorBindingUpdateUnusedWhilePending = BL,
+			.descriptorBindingPartiallyBound = BL,
+			.descriptorBindingVariableDescriptorCount = BL,
+			.runtimeDescriptorArray = BL,
 			.samplerFilterMinmax = VK_FALSE,
 			.scalarBlockLayout = VK_FALSE,
 			.imagelessFramebuffer = VK_FALSE,
@@ -292,15 +423,34 @@ void VK::CreateDevice()
 			.synchronization2 = VK_TRUE,
 			.textureCompressionASTC_HDR = VK_FALSE,
 			.shaderZeroInitializeWorkgroupMemory = VK_FALSE,
+#ifdef USE_DYNAMIC_RENDERING
+			.dynamicRendering = VK_TRUE,
+#else
 			.dynamicRendering = VK_FALSE,
+#endif
 			.shaderIntegerDotProduct = VK_FALSE,
 			.maintenance4 = VK_FALSE,
 		};
+		void* Next = &PDV13F;
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT PDGPLF = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+			.pNext = nullptr,
+			.graphicsPipelineLibrary = VK_TRUE,
+		};
+		if (HasGraphicsPipelineLibrary) { PDGPLF.pNext = Next; Next = &PDGPLF; }
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT PDEDS3F = {
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT,
+			.pNext = nullptr,
+		};
+		PDEDS3F.extendedDynamicState3PolygonMode = VK_TRUE;
+		if (HasDynamicPolygonMode) { PDEDS3F.pNext = Next; Next = &PDEDS3F; }
 		VkPhysicalDeviceFeatures PDF;
 		vkGetPhysicalDeviceFeatures(SelectedPhysDevice.first, &PDF);
+		//!< サポートされている機能は全て有効にする (All supported features are enabled)
+		HasShaderStores = PDF.vertexPipelineStoresAndAtomics && PDF.fragmentStoresAndAtomics;
 		const VkDeviceCreateInfo DCI = {
 			.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-			.pNext = &PDV13F,
+			.pNext = Next,
 			.flags = 0,
 			.queueCreateInfoCount = static_cast<uint32_t>(std::size(DQCIs)), .pQueueCreateInfos = std::data(DQCIs),
 			.enabledLayerCount = 0, .ppEnabledLayerNames = nullptr,
@@ -310,16 +460,37 @@ void VK::CreateDevice()
 		VERIFY_SUCCEEDED(vkCreateDevice(SelectedPhysDevice.first, &DCI, nullptr, &Device));
 	}
 
-	//!< foCX쐬ɁAL[t@~CfbNXƃt@~ł̃CfbNXAL[擾 (After create device, get queue from family index, index in family)
+	//!< デバイス作成後に、キューファミリインデックスとファミリ内でのインデックスから、キューを取得 (After create device, get queue from family index, index in family)
 	vkGetDeviceQueue(Device, GraphicsQueue.second, GraphicsIndexInFamily, &GraphicsQueue.first);
 	vkGetDeviceQueue(Device, PresentQueue.second, PresentIndexInFamily, &PresentQueue.first);
 
+	if (HasPushDescriptor) {
+		vkCmdPushDescriptorSet = reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(vkGetDeviceProcAddr(Device, "vkCmdPushDescriptorSetKHR"));
+	}
+	if (HasDynamicPolygonMode) {
+		vkCmdSetPolygonMode = reinterpret_cast<PFN_vkCmdSetPolygonModeEXT>(vkGetDeviceProcAddr(Device, "vkCmdSetPolygonModeEXT"));
+	}
+
+	CreatePipelineCache();
+
+	//!< デスクリプタセットアロケータ (Descriptor set allocator)
+	{
+		constexpr std::array PSRs = {
+			DescriptorAllocator::PoolSizeRatio({.Type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .Ratio = 2.0f }),
+			DescriptorAllocator::PoolSizeRatio({.Type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .Ratio = 1.0f }),
+			DescriptorAllocator::PoolSizeRatio({.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .Ratio = 2.0f }),
+			DescriptorAllocator::PoolSizeRatio({.Type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .Ratio = 4.0f }),
+			DescriptorAllocator::PoolSizeRatio({.Type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .Ratio = 1.0f }),
+		};
+		DescriptorSetAllocator.Init(Device, 16, PSRs);
+	}
+
 	LOG();
 }
 
 void VK::CreateFenceAndSemaphore()
 {
-	//!< tFXVOiԂō쐬 (Fence, create as signaled) CPU - GPU
+	//!< フェンスをシグナル状態で作成 (Fence, create as signaled) CPU - GPU
 	constexpr VkFenceCreateInfo FCI = {
 		.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
 		.pNext = nullptr,
@@ -341,14 +512,32 @@ void VK::CreateFenceAndSemaphore()
 	VERIFY_SUCCEEDED(vkCreateSemaphore(Device, &SCI, nullptr, &NextImageAcquiredSemaphore));
 	VERIFY_SUCCEEDED(vkCreateSemaphore(Device, &SCI, nullptr, &RenderFinishedSemaphore));
 
+	//!< タイムラインセマフォ (Timeline semaphore) CPU - GPU
+	constexpr VkSemaphoreTypeCreateInfo STCI_Timeline = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+		.pNext = nullptr,
+		.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+		.initialValue = 0
+	};
+	const VkSemaphoreCreateInfo SCI_Timeline = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &STCI_Timeline,
+		.flags = 0
+	};
+	VERIFY_SUCCEEDED(vkCreateSemaphore(Device, &SCI_Timeline, nullptr, &UploadSemaphore));
+
 	LOG();
 }
 
-//!< VK_ERROR_OUT_OF_DATE_KHR ŎsƂXbv`FCj (Destroy swapchain when failed with VK_ERROR_OUT_OF_DATE_KHR)
-//!< ReCreateSwapchain() ō蒼Kv (Need to recreate by ReCreateSwapchain())
+//!< VK_ERROR_OUT_OF_DATE_KHR で失敗したときスワップチェインを破棄する (Destroy swapchain when failed with VK_ERROR_OUT_OF_DATE_KHR)
+//!< ReCreateSwapchain() で作り直す必要がある (Need to recreate by ReCreateSwapchain())
 void VK::DestroySwapchain()
 {
-	VERIFY_SUCCEEDED(vkDeviceWaitIdle(Device));
+	{
+		//!< 全キューへのアクセスを外部同期する必要がある (Access to all queues must be externally synchronized)
+		std::lock_guard Lock(QueueMutex);
+		VERIFY_SUCCEEDED(vkDeviceWaitIdle(Device));
+	}
 
 	for (auto i : Framebuffers) {
 		vkDestroyFramebuffer(Device, i, nullptr);
@@ -369,16 +558,16 @@ void VK::DestroySwapchain()
 }
 bool VK::ReCreateSwapchain()
 {
-	//!< Xbv`FCSȂ牽Ȃ (If swapchain is healthy, do nothing)
+	//!< スワップチェインが健全なら何もしない (If swapchain is healthy, do nothing)
 	if (VK_NULL_HANDLE == Swapchain.VkSwapchain) {
 		if (CreateSwapchain()) {
 			CreateFramebuffer();
 
-			//!< TCYꂽ\̂łĂ (May be resized)
+			//!< リサイズされた可能性があるのでやっておく (May be resized)
 			DestroyViewports();
 			CreateViewports();
 
-			//!< t[obt@蒼ꂽ̂ŁAR}hs蒼 (Framebuffer is recreated, repopulate commands)
+			//!< フレームバッファが作り直されたので、コマンド発行をやり直す (Framebuffer is recreated, repopulate commands)
 			PopulateCommandBuffer();
 
 			LOG();
@@ -416,27 +605,219 @@ void VK::CreatePipelineLayout()
 VkShaderModule VK::CreateShaderModule(const std::filesystem::path& Path)
 {
 	VkShaderModule SM = VK_NULL_HANDLE;
+	//!< コピーせずにマップしたまま渡す (マップ先はページ境界なので 4 バイトアライン) (Pass mapped memory without copy (page aligned, so 4 byte aligned))
+	const MappedFile MF(Path);
+	if (MF.IsValid()) {
+		const auto Code = MF.GetData();
+		SM = CreateShaderModule(std::span<const uint32_t>(reinterpret_cast<const uint32_t*>(std::data(Code)), std::size(Code) / sizeof(uint32_t)));
+	}
+	assert(VK_NULL_HANDLE != SM && "Shader module create failed");
+	return SM;
+};
+VkShaderModule VK::CreateShaderModule(std::span<const uint32_t> Code)
+{
+	VkShaderModule SM = VK_NULL_HANDLE;
+	const VkShaderModuleCreateInfo SMCI = {
+		.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		.pNext = nullptr,
+		.flags = 0,
+		.codeSize = Code.size_bytes(), .pCode = std::data(Code)
+	};
+	VERIFY_SUCCEEDED(vkCreateShaderModule(Device, &SMCI, nullptr, &SM));
+	{
+		//!< パイプラインライブラリのキーに使用する (Used as key of pipeline library)
+		std::lock_guard Lock(ShaderModuleHashMutex);
+		ShaderModuleHashes[SM] = HashBytes(HashSeed, std::as_bytes(Code));
+	}
+	return SM;
+}
+size_t VK::GetShaderModuleHash(const VkShaderModule SM)
+{
+	std::lock_guard Lock(ShaderModuleHashMutex);
+	const auto It = ShaderModuleHashes.find(SM);
+	return std::end(ShaderModuleHashes) != It ? It->second : 0;
+}
+
+void VK::Shutdown()
+{
+	if (std::exchange(IsShutdown, true)) { return; }
+
+	//!< テクスチャのアップロードは派生クラスのメンバ (パス等) を参照するので、派生クラスが破棄される前に待つ
+	//!< (Texture upload refers to members of derived class (path etc.), so wait before derived class is destroyed)
+	JobSystem::Get().Wait(TextureUploadJobs);
+	//!< パイプラインの作り直しは派生クラスの CreatePipeline() を呼ぶので同様 (Pipeline recreation calls CreatePipeline() of derived class, so likewise)
+	JobSystem::Get().Wait(PipelineRecreateJob);
+
+	//!< 処理の完了を待つ (Wait for idle)
+	if (VK_NULL_HANDLE != Device) {
+		VERIFY_SUCCEEDED(vkDeviceWaitIdle(Device));
+	}
+	if (VK_NULL_HANDLE != PipelineCache) {
+		SavePipelineCache();
+	}
+}
+std::filesystem::path VK::GetExecutableDirectory()
+{
+#ifdef _WIN64
+	std::array<wchar_t, MAX_PATH> Path;
+	const auto Length = GetModuleFileNameW(nullptr, std::data(Path), static_cast<DWORD>(std::size(Path)));
+	if (0 < Length && Length < std::size(Path)) {
+		return std::filesystem::path(std::wstring_view(std::data(Path), Length)).parent_path();
+	}
+#else
+	std::error_code EC;
+	const auto Path = std::filesystem::read_symlink("/proc/self/exe", EC);
+	if (!EC) {
+		return Path.parent_path();
+	}
+#endif
+	return std::filesystem::current_path();
+}
+
+void VK::CreatePipelineCache()
+{
+	const auto& PDP = SelectedPhysDevice.second.PDP;
+
+	std::vector<std::byte> Data;
+	const auto Path = GetPipelineCachePath();
 	std::ifstream In(data(Path.string()), std::ios::in | std::ios::binary);
 	if (!In.fail()) {
-		In.seekg(0, std::ios_base::end);
-		const auto Size = In.tellg();
-		if (Size) {
-			In.seekg(0, std::ios_base::beg);
-			std::vector<std::byte> Code(Size);
-			In.read(reinterpret_cast<char*>(std::data(Code)), std::size(Code));
-			const VkShaderModuleCreateInfo SMCI = {
-				.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-				.pNext = nullptr,
-				.flags = 0,
-				.codeSize = static_cast<size_t>(std::size(Code)), .pCode = reinterpret_cast<uint32_t*>(std::data(Code))
-			};
-			VERIFY_SUCCEEDED(vkCreateShaderModule(Device, &SMCI, nullptr, &SM));
+		std::error_code EC;
+		const auto FileSize = std::filesystem::file_size(Path, EC);
+		PipelineCacheHeader PCH;
+		In.read(reinterpret_cast<char*>(&PCH), sizeof(PCH));
+		//!< デバイス UUID、ドライババージョンが一致する場合のみ使用する (Use only if device UUID and driver version match)
+		//!< ファイルから読んだサイズは信用せず、ファイルサイズに収まる場合のみ確保する (Size read from file is not trusted, allocated only if it fits in file size)
+		if (In && !EC
+			&& FileSize >= sizeof(PCH) && PCH.DataSize <= FileSize - sizeof(PCH)
+			&& PipelineCacheMagic == PCH.Magic
+			&& PDP.vendorID == PCH.VendorID && PDP.deviceID == PCH.DeviceID && PDP.driverVersion == PCH.DriverVersion
+			&& 0 == std::memcmp(PDP.pipelineCacheUUID, PCH.PipelineCacheUUID, sizeof(PCH.PipelineCacheUUID))) {
+			Data.resize(PCH.DataSize);
+			In.read(reinterpret_cast<char*>(std::data(Data)), std::size(Data));
+			if (!In) { Data.clear(); }
+		}
+		else {
+			std::cout << "Pipeline cache is discarded (device or driver changed)" << std::endl;
 		}
 		In.close();
 	}
-	assert(VK_NULL_HANDLE != SM && "Shader module create failed");
-	return SM;
-};
+	std::cout << "Pipeline cache : " << std::size(Data) << " bytes loaded" << std::endl;
+
+	const VkPipelineCacheCreateInfo PCCI = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+		.pNext = nullptr,
+		.flags = 0,
+		.initialDataSize = std::size(Data), .pInitialData = std::data(Data)
+	};
+	VERIFY_SUCCEEDED(vkCreatePipelineCache(Device, &PCCI, nullptr, &PipelineCache));
+}
+void VK::SavePipelineCache()
+{
+	size_t Size = 0;
+	VERIFY_SUCCEEDED(vkGetPipelineCacheData(Device, PipelineCache, &Size, nullptr));
+	std::vector<std::byte> Data(Size);
+	VERIFY_SUCCEEDED(vkGetPipelineCacheData(Device, PipelineCache, &Size, std::data(Data)));
+	if (0 == Size) { return; }
+
+	const auto& PDP = SelectedPhysDevice.second.PDP;
+	PipelineCacheHeader PCH = {
+		.Magic = PipelineCacheMagic,
+		.VendorID = PDP.vendorID, .DeviceID = PDP.deviceID, .DriverVersion = PDP.driverVersion,
+		.PipelineCacheUUID = {},
+		.DataSize = Size
+	};
+	std::memcpy(PCH.PipelineCacheUUID, PDP.pipelineCacheUUID, sizeof(PCH.PipelineCacheUUID));
+
+	std::ofstream Out(data(GetPipelineCachePath().string()), std::ios::out | std::ios::binary);
+	if (!Out.fail()) {
+		Out.write(reinterpret_cast<const char*>(&PCH), sizeof(PCH));
+		Out.write(reinterpret_cast<const char*>(std::data(Data)), Size);
+		Out.close();
+	}
+}
+
+size_t VK::HashFile(const std::filesystem::path& Path)
+{
+	const MappedFile MF(Path);
+	return MF.IsValid() ? HashBytes(HashSeed, MF.GetData()) : 0;
+}
+size_t VK::GetTextureCacheKey(const size_t ContentHash, const VkFormat Format, const VkComponentMapping& CM, const bool Mipmap, const uint32_t Variant)
+{
+	//!< ソースが読めない場合はキャッシュしない (Not cached if source is not readable)
+	if (0 == ContentHash) { return 0; }
+	auto Key = HashCombine(ContentHash, Format);
+	Key = HashCombine(Key, CM);
+	Key = HashCombine(Key, Mipmap);
+	return HashCombine(Key, Variant);
+}
+#ifdef USE_CV
+cv::Mat VK::LoadCVTextureCache(const size_t Key, const std::function<cv::Mat()>& Decode) const
+{
+	if (0 == Key) { return Decode(); }
+
+	std::stringstream SS;
+	SS << std::hex << std::setw(16) << std::setfill('0') << Key << ".bin";
+	const auto Path = GetTextureCacheDirectory() / SS.str();
+	{
+		std::error_code EC;
+		const auto FileSize = std::filesystem::file_size(Path, EC);
+		std::ifstream In(data(Path.string()), std::ios::in | std::ios::binary);
+		if (!EC && !In.fail()) {
+			TextureCacheHeader TCH;
+			In.read(reinterpret_cast<char*>(&TCH), sizeof(TCH));
+			//!< 確保、読み込みの前に、ヘッダがファイルサイズと一致するか検証する (途中で切れたもの、古い形式のもの等を弾く)
+			//!< (Validate header against file size before allocation and read (reject truncated, stale format etc.))
+			const auto IsValid = [&]() {
+				if (!In || sizeof(TCH) > FileSize || TextureCacheMagic != TCH.Magic || Key != TCH.Key) { return false; }
+				if (CV_MAT_DEPTH(TCH.Type) > CV_16F || CV_MAT_CN(TCH.Type) > 4) { return false; }
+				constexpr auto IntMax = static_cast<uint32_t>((std::numeric_limits<int>::max)());
+				if (0 == TCH.Rows || 0 == TCH.Cols || TCH.Rows > IntMax || TCH.Cols > IntMax) { return false; }
+				//!< 行のサイズで割って比較し、乗算のオーバーフローを避ける (Compare by dividing by row size, to avoid overflow of multiplication)
+				const auto RowSize = static_cast<uint64_t>(TCH.Cols) * CV_ELEM_SIZE(TCH.Type);
+				const auto DataSize = static_cast<uint64_t>(FileSize - sizeof(TCH));
+				return 0 == DataSize % RowSize && TCH.Rows == DataSize / RowSize;
+			};
+			if (IsValid()) {
+				cv::Mat CvMat(static_cast<int>(TCH.Rows), static_cast<int>(TCH.Cols), TCH.Type);
+				In.read(reinterpret_cast<char*>(CvMat.ptr()), CvMat.total() * CvMat.elemSize());
+				if (In) { return CvMat; }
+			}
+			//!< 壊れたキャッシュは削除してデコードし直す (Delete corrupted cache and decode again)
+			In.close();
+			std::cerr << "Texture cache " << Path << " is invalid, removed" << std::endl;
+			std::filesystem::remove(Path, EC);
+		}
+	}
+
+	auto CvMat = Decode();
+	if (!CvMat.empty()) {
+		std::error_code EC;
+		std::filesystem::create_directories(GetTextureCacheDirectory(), EC);
+		//!< 書き込み途中のファイルを読まないように、一時ファイルへ書いてから置き換える (Write to temporary file then replace, so as not to read partially written file)
+		auto Tmp = Path; Tmp += ".tmp";
+		std::ofstream Out(data(Tmp.string()), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!Out.fail()) {
+			const TextureCacheHeader TCH = {
+				.Magic = TextureCacheMagic,
+				.Type = CvMat.type(),
+				.Key = Key,
+				.Rows = static_cast<uint32_t>(CvMat.rows), .Cols = static_cast<uint32_t>(CvMat.cols)
+			};
+			Out.write(reinterpret_cast<const char*>(&TCH), sizeof(TCH));
+			//!< 連続していない (ROI) 場合もあるので行毎に書き出す (Write per row, as it may not be continuous (ROI))
+			for (auto i = 0; i < CvMat.rows; ++i) {
+				Out.write(reinterpret_cast<const char*>(CvMat.ptr(i)), CvMat.cols * CvMat.elemSize());
+			}
+			Out.close();
+			if (!Out.fail()) {
+				std::filesystem::rename(Tmp, Path, EC);
+			}
+		}
+	}
+	return CvMat;
+}
+#endif
 
 void VK::CreateViewports() 
 {
@@ -483,7 +864,7 @@ void VK::WaitFence()
 
 bool VK::AcquireNextImage() 
 {
-	//!< ̃C[WCfbNX擾AC[W擾oZ}tH (A) VOi (Acquire next image index, on acquire semaphore A will be signaled)
+	//!< 次のイメージインデックスを取得、イメージが取得出来たらセマフォ (A) がシグナルされる (Acquire next image index, on acquire semaphore A will be signaled)
 	const auto Result = vkAcquireNextImageKHR(Device, Swapchain.VkSwapchain, (std::numeric_limits<uint64_t>::max)(), NextImageAcquiredSemaphore, VK_NULL_HANDLE, &Swapchain.Index);
 	if (Result == VK_ERROR_OUT_OF_DATE_KHR) {
 		DestroySwapchain();
@@ -498,8 +879,29 @@ bool VK::AcquireNextImage()
 void VK::Submit()
 {
 	const auto& CB = PrimaryCommandBuffers[0].second[Swapchain.Index];
-	//!< ̃C[W擾 Z}tH (A) VOi閘҂ (Wait next image acquired signal (A))
-	//!< _OZ}tH (B) VOi (Rendering finish will be singnaled (B))
+
+	//!< フレーム毎の転送、直前のフレームは WaitFence() で完了しているので再記録できる (Per frame transfer, previous frame has completed in WaitFence(), so can be re-recorded)
+	const auto TCB = TransferCommandBuffers[0].second[0];
+	constexpr VkCommandBufferBeginInfo CBBI = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = nullptr,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = nullptr
+	};
+	VERIFY_SUCCEEDED(vkBeginCommandBuffer(TCB, &CBBI));
+	const auto HasTransfer = PopulateTransferCommandBuffer(TCB);
+	VERIFY_SUCCEEDED(vkEndCommandBuffer(TCB));
+	const std::array TransferCBSIs = {
+		VkCommandBufferSubmitInfo({
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+			.pNext = nullptr,
+			.commandBuffer = TCB,
+			.deviceMask = 0
+			})
+	};
+
+	//!< 次のイメージ取得 セマフォ (A) がシグナルされる迄待つ (Wait next image acquired signal (A))
+	//!< レンダリング完了セマフォ (B) がシグナルされる (Rendering finish will be singnaled (B))
 	const std::array WaitSSIs = {
 		VkSemaphoreSubmitInfo({
 			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
@@ -529,6 +931,16 @@ void VK::Submit()
 			})
 	};
 	const std::array SIs = {
+		//!< 転送はイメージの取得を待たない、フレームのコマンドとの同期は転送側のバリアで取る
+		//!< (Transfer does not wait for image acquisition, synchronized with commands of frame by barriers on transfer side)
+		VkSubmitInfo2({
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+			.pNext = nullptr,
+			.flags = 0,
+			.waitSemaphoreInfoCount = 0, .pWaitSemaphoreInfos = nullptr,
+			.commandBufferInfoCount = static_cast<uint32_t>(std::size(TransferCBSIs)), .pCommandBufferInfos = std::data(TransferCBSIs),
+			.signalSemaphoreInfoCount = 0, .pSignalSemaphoreInfos = nullptr
+		}),
 		VkSubmitInfo2({
 			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
 			.pNext = nullptr,
@@ -538,13 +950,18 @@ void VK::Submit()
 			.signalSemaphoreInfoCount = static_cast<uint32_t>(std::size(SignalSSIs)), .pSignalSemaphoreInfos = std::data(SignalSSIs)
 		})
 	};
-	VERIFY_SUCCEEDED(vkQueueSubmit2(GraphicsQueue.first, static_cast<uint32_t>(std::size(SIs)), std::data(SIs), Fence));
+	//!< 転送が無ければフレームのみ (Frame only if no transfer)
+	const auto SISkip = HasTransfer ? 0 : 1;
+	{
+		std::lock_guard Lock(QueueMutex);
+		VERIFY_SUCCEEDED(vkQueueSubmit2(GraphicsQueue.first, static_cast<uint32_t>(std::size(SIs) - SISkip), std::data(SIs) + SISkip, Fence));
+	}
 
 	if (0 == FrameCount) { LOG(); }
 }
 bool VK::Present()
 {
-	//!< _OZ}tH (B) VOi閘҂ (Wait for rendering finish signal (B))
+	//!< レンダリング完了セマフォ (B) がシグナルされる迄待つ (Wait for rendering finish signal (B))
 	const std::array WaitSems = { RenderFinishedSemaphore };
 	const std::array Swapchains = { Swapchain.VkSwapchain };
 	const std::array ImageIndices = { Swapchain.Index };
@@ -555,7 +972,11 @@ bool VK::Present()
 		.swapchainCount = static_cast<uint32_t>(std::size(Swapchains)), .pSwapchains = std::data(Swapchains), .pImageIndices = std::data(ImageIndices),
 		.pResults = nullptr
 	};
-	const auto Result = vkQueuePresentKHR(PresentQueue.first, &PI);
+	VkResult Result;
+	{
+		std::lock_guard Lock(QueueMutex);
+		Result = vkQueuePresentKHR(PresentQueue.first, &PI);
+	}
 	if (Result == VK_ERROR_OUT_OF_DATE_KHR || Result == VK_SUBOPTIMAL_KHR) {
 		DestroySwapchain();
 		return false;
@@ -626,7 +1047,7 @@ bool VK::CreateSwapchain(const uint32_t Width, const uint32_t Height)
 {
 	VkSurfaceCapabilitiesKHR SC;
 	VERIFY_SUCCEEDED(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(SelectedPhysDevice.first, Surface, &SC));
-	//!< VK_ERROR_OUT_OF_DATE_KHR A0 ԂԂ莸sƂĈ (For a while after VK_ERROR_OUT_OF_DATE_KHR, treat as failure)
+	//!< VK_ERROR_OUT_OF_DATE_KHR 後、0 が返る期間があり失敗として扱う (For a while after VK_ERROR_OUT_OF_DATE_KHR, treat as failure)
 	if (0 == SC.currentExtent.width) {
 		return false;
 	}
@@ -645,10 +1066,10 @@ bool VK::CreateSwapchain(const uint32_t Width, const uint32_t Height)
 		std::vector<VkPresentModeKHR> PMs(Count);
 		VERIFY_SUCCEEDED(vkGetPhysicalDeviceSurfacePresentModesKHR(SelectedPhysDevice.first, Surface, &Count, std::data(PMs)));
 
-		//!< MAILBOX T|[gȂ̗p (Select if MAILBOX supported)
+		//!< MAILBOX がサポートされるなら採用する (Select if MAILBOX supported)
 		auto It = std::ranges::find(PMs, VK_PRESENT_MODE_MAILBOX_KHR);
 		if (It == std::end(PMs)) {
-			//!< Ȃꍇ͕KT|[g FIFO I (If not found, select FIFO)
+			//!< 見つからない場合は必ずサポートされる FIFO を選択 (If not found, select FIFO)
 			It = std::ranges::find(PMs, VK_PRESENT_MODE_FIFO_KHR);
 		}
 		SelectedPresentMode = *It;
@@ -659,7 +1080,7 @@ bool VK::CreateSwapchain(const uint32_t Width, const uint32_t Height)
 		.pNext = nullptr,
 		.flags = 0,
 		.surface = Surface,
-		//!< C[W͍ŏ + 1 ] (Want minImageCount + 1)
+		//!< イメージ数は最小 + 1 を希望 (Want minImageCount + 1)
 		.minImageCount = (std::min)(SC.minImageCount + 1, 0 == SC.maxImageCount ? (std::numeric_limits<uint32_t>::max)() : SC.maxImageCount),
 		.imageFormat = SelectedSurfaceFormat.format, .imageColorSpace = SelectedSurfaceFormat.colorSpace,
 		.imageExtent = Swapchain.Extent,
@@ -671,11 +1092,11 @@ bool VK::CreateSwapchain(const uint32_t Width, const uint32_t Height)
 		.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
 		.presentMode = SelectedPresentMode,
 		.clipped = VK_TRUE,
-		.oldSwapchain = VK_NULL_HANDLE //!< Xbv`FC쓮ɍ蒼ꍇɎw肷 (Use when swapchain is running)
+		.oldSwapchain = VK_NULL_HANDLE //!< スワップチェイン駆動中に作り直す場合に指定する (Use when swapchain is running)
 	};
 	VERIFY_SUCCEEDED(vkCreateSwapchainKHR(Device, &SCI, nullptr, &Swapchain.VkSwapchain));
 
-	//!< C[Wr[ (Image views)
+	//!< イメージビュー (Image views)
 	{
 		std::vector<VkImage> Images;
 		uint32_t Count;
@@ -726,8 +1147,8 @@ void VK::CopyToHostVisibleMemory(const VkDeviceMemory DeviceMemory, const VkDevi
 	VERIFY_SUCCEEDED(vkMapMemory(Device, DeviceMemory, Offset, MappedRangeSize, static_cast<VkMemoryMapFlags>(0), &Data)); {
 		std::memcpy(Data, Source, Size);
 
-		//!< ł̓RecύXꂽƂ𖾎IɃhCo֒m点鎖Ƃ (Here, inform driver contents is changed)
-		//!< vkMapMemory() Ԃł邱 (Must be vkMapMemory())
+		//!< ここではメモリコンテンツが変更されたことを明示的にドライバへ知らせる事とする (Here, inform driver contents is changed)
+		//!< vkMapMemory() した状態でやること (Must be vkMapMemory())
 		if (true/*!VK_MEMORY_PROPERTY_HOST_COHERENT_BIT*/) {
 			const std::array MMRs = {
 				VkMappedMemoryRange({
@@ -743,6 +1164,38 @@ void VK::CopyToHostVisibleMemory(const VkDeviceMemory DeviceMemory, const VkDevi
 
 	} vkUnmapMemory(Device, DeviceMemory);
 }
+#ifdef USE_CV
+void VK::CopyToHostVisibleMemory(const VkDeviceMemory DeviceMemory, const VkDeviceSize Offset, const cv::Mat& CvMat) const
+{
+	if (CvMat.empty()) { return; }
+	//!< フラッシュする範囲はマップした範囲に含まれている必要があるので全体をマップする (Map whole memory, as flushed range must be within mapped range)
+	void* Mapped;
+	VERIFY_SUCCEEDED(vkMapMemory(Device, DeviceMemory, 0, VK_WHOLE_SIZE, static_cast<VkMemoryMapFlags>(0), &Mapped)); {
+		const auto Data = static_cast<std::byte*>(Mapped) + Offset;
+		if (CvMat.isContinuous()) {
+			std::memcpy(Data, CvMat.ptr(), CvMat.total() * CvMat.elemSize());
+		}
+		else {
+			//!< 行間 (親の他の列) はコピーしない (Gap between rows (other columns of parent) is not copied)
+			const auto Pitch = GetStagingPitch(CvMat);
+			const auto RowSize = CvMat.cols * CvMat.elemSize();
+			for (auto i = 0; i < CvMat.rows; ++i) {
+				std::memcpy(Data + i * Pitch, CvMat.ptr(i), RowSize);
+			}
+		}
+		const std::array MMRs = {
+			VkMappedMemoryRange({
+				.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+				.pNext = nullptr,
+				.memory = DeviceMemory,
+				.offset = 0,
+				.size = VK_WHOLE_SIZE
+			})
+		};
+		VERIFY_SUCCEEDED(vkFlushMappedMemoryRanges(Device, static_cast<uint32_t>(std::size(MMRs)), std::data(MMRs)));
+	} vkUnmapMemory(Device, DeviceMemory);
+}
+#endif
 
 void VK::CreateBuffer(VkBuffer* Buffer, VkDeviceMemory* DeviceMemory, const VkBufferUsageFlags BUF, const VkMemoryPropertyFlags MPF, const size_t Size, const void* Source) const
 {
@@ -783,6 +1236,38 @@ void VK::CreateBuffer(VkBuffer* Buffer, VkDeviceMemory* DeviceMemory, const VkBu
 		CopyToHostVisibleMemory(*DeviceMemory, 0, Size, Source);
 	}
 }
+void VK::CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const TextureFile& TF, std::vector<VkBufferImageCopy2>& BICs) const
+{
+	const auto& Regions = TF.GetRegions();
+	const auto Base = std::size(BICs);
+	//!< bufferOffset はブロックサイズの倍数であること (bufferOffset must be multiple of block size)
+	const auto BlockSize = static_cast<VkDeviceSize>(gli::block_size(TF.GetFormat()));
+	VkDeviceSize Size = 0;
+	BICs.reserve(Base + std::size(Regions));
+	for (const auto& i : Regions) {
+		Size = (Size + BlockSize - 1) / BlockSize * BlockSize;
+		BICs.emplace_back(VkBufferImageCopy2({
+			.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
+			.pNext = nullptr,
+			.bufferOffset = Size, .bufferRowLength = 0, .bufferImageHeight = 0,
+			.imageSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = i.Level, .baseArrayLayer = i.Layer, .layerCount = 1 }),
+			.imageOffset = VkOffset3D({.x = 0, .y = 0, .z = 0 }),
+			.imageExtent = VkExtent3D({.width = static_cast<uint32_t>(i.Extent.x), .height = static_cast<uint32_t>(i.Extent.y), .depth = static_cast<uint32_t>(i.Extent.z) }) }));
+		Size += static_cast<VkDeviceSize>(i.Size);
+	}
+
+	CreateHostVisibleBuffer(BADM, BUF, static_cast<size_t>(Size), nullptr);
+
+	//!< 中間バッファを介さず、マップされたファイルからマップされたステージングへ 1 回だけコピーする (Copy only once from mapped file to mapped staging, without intermediate buffer)
+	const auto Data = TF.GetData();
+	void* Mapped;
+	VERIFY_SUCCEEDED(vkMapMemory(Device, BADM.second, 0, VK_WHOLE_SIZE, static_cast<VkMemoryMapFlags>(0), &Mapped)); {
+		for (size_t i = 0; i < std::size(Regions); ++i) {
+			std::memcpy(static_cast<std::byte*>(Mapped) + BICs[Base + i].bufferOffset, std::data(Data) + Regions[i].Offset, Regions[i].Size);
+		}
+		//!< HOST_COHERENT で確保しているのでフラッシュは不要 (Allocated as HOST_COHERENT, no flush needed)
+	} vkUnmapMemory(Device, BADM.second);
+}
 
 void VK::CreateImage(VkImage* Image, VkDeviceMemory* DeviceMemory, const VkImageCreateInfo& ICI)
 {
@@ -908,13 +1393,11 @@ void VK::PopulateCopyCommand(const VkCommandBuffer CB,
 		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, IL,
 		ISR);
 }
-void VK::PopulateCopyCommand(const VkCommandBuffer CB,
-	const VkBuffer Staging, const VkImage Image, const gli::texture& Gli,
-	const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF) const
+void VK::GetBufferImageCopies(const gli::texture& Gli, std::vector<VkBufferImageCopy2>& BICs)
 {
 	const auto Layers = static_cast<uint32_t>(Gli.layers()) * static_cast<uint32_t>(Gli.faces());
 	const auto Levels = static_cast<uint32_t>(Gli.levels());
-	std::vector<VkBufferImageCopy2> BICs; BICs.reserve(Layers * Levels);
+	BICs.reserve(std::size(BICs) + Layers * Levels);
 	VkDeviceSize Offset = 0;
 	for (uint32_t i = 0; i < Layers; ++i) {
 		for (uint32_t j = 0; j < Levels; ++j) {
@@ -928,6 +1411,13 @@ void VK::PopulateCopyCommand(const VkCommandBuffer CB,
 			Offset += static_cast<VkDeviceSize>(Gli.size(j));
 		}
 	}
+}
+void VK::PopulateCopyCommand(const VkCommandBuffer CB,
+	const VkBuffer Staging, const VkImage Image, const gli::texture& Gli,
+	const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF) const
+{
+	std::vector<VkBufferImageCopy2> BICs;
+	GetBufferImageCopies(Gli, BICs);
 	constexpr auto ISR = VkImageSubresourceRange({
 		.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
 		.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
@@ -952,7 +1442,7 @@ void VK::PopulateCopyCommand(const VkCommandBuffer CB,
 			BICs.emplace_back(VkBufferImageCopy2({
 				.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
 				.pNext = nullptr,
-				.bufferOffset = Offset, .bufferRowLength = 0, .bufferImageHeight = 0,
+				.bufferOffset = Offset, .bufferRowLength = static_cast<uint32_t>(GetStagingPitch(CvMat) / CvMat.elemSize()), .bufferImageHeight = 0,
 				.imageSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = j, .baseArrayLayer = i, .layerCount = 1 }),
 				.imageOffset = VkOffset3D({.x = 0, .y = 0, .z = 0 }),
 				.imageExtent = VkExtent3D({.width = static_cast<uint32_t>(CvMat.cols), .height = static_cast<uint32_t>(CvMat.rows), .depth = 1 }) }));
@@ -969,6 +1459,80 @@ void VK::PopulateCopyCommand(const VkCommandBuffer CB,
 		IL, AF, PSF);
 }
 #endif
+uint32_t VK::GetMipLevels(const VkFormat Format, const uint32_t Width, const uint32_t Height) const
+{
+	if (!IsSupportedFormat(Format, VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) {
+		return 1;
+	}
+	//!< 1x1 まで (Down to 1x1)
+	return static_cast<uint32_t>(std::bit_width((std::max)(Width, Height)));
+}
+void VK::PopulateMipmapCommand(const VkCommandBuffer CB,
+	const VkImage Image, const uint32_t Width, const uint32_t Height, const uint32_t MipLevels,
+	const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlags2 PSF) const
+{
+	auto W = static_cast<int32_t>(Width), H = static_cast<int32_t>(Height);
+	for (uint32_t i = 1; i < MipLevels; ++i) {
+		//!< 前のレベルの書き込み完了を待ち、ブリット元にする (Wait for previous level written, make it blit source)
+		ImageMemoryBarrier(CB,
+			Image,
+			VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT,
+			VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_TRANSFER_READ_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			VkImageSubresourceRange({
+				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+				.baseMipLevel = i - 1, .levelCount = 1,
+				.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+			}));
+
+		const auto DstW = (std::max)(W >> 1, 1), DstH = (std::max)(H >> 1, 1);
+		const std::array IBs = {
+			VkImageBlit2({
+				.sType = VK_STRUCTURE_TYPE_IMAGE_BLIT_2,
+				.pNext = nullptr,
+				.srcSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = i - 1, .baseArrayLayer = 0, .layerCount = 1 }),
+				.srcOffsets = { VkOffset3D({.x = 0, .y = 0, .z = 0 }), VkOffset3D({.x = W, .y = H, .z = 1 }) },
+				.dstSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = i, .baseArrayLayer = 0, .layerCount = 1 }),
+				.dstOffsets = { VkOffset3D({.x = 0, .y = 0, .z = 0 }), VkOffset3D({.x = DstW, .y = DstH, .z = 1 }) },
+			}),
+		};
+		const VkBlitImageInfo2 BII = {
+			.sType = VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2,
+			.pNext = nullptr,
+			.srcImage = Image, .srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			.dstImage = Image, .dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			.regionCount = static_cast<uint32_t>(std::size(IBs)), .pRegions = std::data(IBs),
+			.filter = VK_FILTER_LINEAR
+		};
+		vkCmdBlitImage2(CB, &BII);
+
+		W = DstW; H = DstH;
+	}
+
+	//!< 最後のレベル以外はブリット元、最後のレベルはブリット先のレイアウトになっている (All but last level are in blit source layout, last level is in blit destination layout)
+	if (1 < MipLevels) {
+		ImageMemoryBarrier(CB,
+			Image,
+			VK_PIPELINE_STAGE_2_BLIT_BIT, PSF,
+			VK_ACCESS_2_TRANSFER_READ_BIT, AF,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, IL,
+			VkImageSubresourceRange({
+				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+				.baseMipLevel = 0, .levelCount = MipLevels - 1,
+				.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+			}));
+	}
+	ImageMemoryBarrier(CB,
+		Image,
+		VK_PIPELINE_STAGE_2_TRANSFER_BIT, PSF,
+		VK_ACCESS_2_TRANSFER_WRITE_BIT, AF,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, IL,
+		VkImageSubresourceRange({
+			.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+			.baseMipLevel = MipLevels - 1, .levelCount = 1,
+			.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+		}));
+}
 
 void VK::CreateGeometry(const std::vector<VK::GeometryCreateInfo>& GCIs)
 {
@@ -990,7 +1554,7 @@ void VK::CreateGeometry(const std::vector<VK::GeometryCreateInfo>& GCIs)
 		auto& GCC = GCCs.emplace_back();
 		GCC.GCI = &i;
 
-		//!< o[ebNXobt@AXe[WO̍쐬 (Create vertex buffer, staging)
+		//!< バーテックスバッファ、ステージングの作成 (Create vertex buffer, staging)
 		for (const auto& j : i.Vtxs) {
 			auto& VSB = GCC.VertexStagingBuffers.emplace_back(BufferAndDeviceMemory({ VK_NULL_HANDLE, VK_NULL_HANDLE }));
 			GCC.VertexStart = std::size(VertexBuffers);
@@ -998,7 +1562,7 @@ void VK::CreateGeometry(const std::vector<VK::GeometryCreateInfo>& GCIs)
 			CreateHostVisibleBuffer(VSB, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, j.first, j.second);
 		}
 
-		//!< CfbNXobt@AXe[WO̍쐬 (Create index buffer, staging)
+		//!< インデックスバッファ、ステージングの作成 (Create index buffer, staging)
 		const auto HasIdx = i.Idx.first != 0 && i.Idx.second != nullptr && i.IdxCount != 0;
 		if (HasIdx) {
 			GCC.IndexStart = std::size(IndexBuffers);
@@ -1006,7 +1570,7 @@ void VK::CreateGeometry(const std::vector<VK::GeometryCreateInfo>& GCIs)
 			CreateHostVisibleBuffer(GCC.IndexStagingBuffer, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, i.Idx.first, i.Idx.second);
 		}
 
-		//!< C_CNgobt@AXe[WO̍쐬 (Create indirect buffer, staging)
+		//!< インダイレクトバッファ、ステージングの作成 (Create indirect buffer, staging)
 		GCC.IndirectStart = std::size(IndirectBuffers);
 		if (HasIdx) {
 			GCC.DIIC = VkDrawIndexedIndirectCommand({
@@ -1053,7 +1617,7 @@ void VK::CreateGeometry(const std::vector<VK::GeometryCreateInfo>& GCIs)
 		}
 	} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
 
-	//!< Rs[R}hs (Submit copy command)
+	//!< コピーコマンド発行 (Submit copy command)
 	SubmitAndWait(CB);
 
 	for (const auto& i : GCCs) {
@@ -1123,13 +1687,37 @@ VK::Texture& VK::CreateTexture(const VkFormat Format, const uint32_t Width, cons
 
 VkFormat VK::ToVkFormat(const gli::format GLIFormat) 
 {
+	//!< FORMAT_RG4_UNORM_PACK8 から FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16 迄 (BC, ETC2, EAC, ASTC を含む) は VkFormat と同じ値で並んでいる
+	//!< (From FORMAT_RG4_UNORM_PACK8 to FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16 (including BC, ETC2, EAC, ASTC) have same values as VkFormat)
+	static_assert(static_cast<int>(gli::FORMAT_RG4_UNORM_PACK8) == static_cast<int>(VK_FORMAT_R4G4_UNORM_PACK8));
+	static_assert(static_cast<int>(gli::FORMAT_RGBA8_UNORM_PACK8) == static_cast<int>(VK_FORMAT_R8G8B8A8_UNORM));
+	static_assert(static_cast<int>(gli::FORMAT_RGBA16_SFLOAT_PACK16) == static_cast<int>(VK_FORMAT_R16G16B16A16_SFLOAT));
+	static_assert(static_cast<int>(gli::FORMAT_RGB_DXT1_UNORM_BLOCK8) == static_cast<int>(VK_FORMAT_BC1_RGB_UNORM_BLOCK));
+	static_assert(static_cast<int>(gli::FORMAT_RGBA_BP_SRGB_BLOCK16) == static_cast<int>(VK_FORMAT_BC7_SRGB_BLOCK));
+	static_assert(static_cast<int>(gli::FORMAT_RGB_ETC2_UNORM_BLOCK8) == static_cast<int>(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK));
+	static_assert(static_cast<int>(gli::FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16) == static_cast<int>(VK_FORMAT_ASTC_12x12_SRGB_BLOCK));
+	if (gli::FORMAT_RG4_UNORM_PACK8 <= GLIFormat && GLIFormat <= gli::FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16) {
+		return static_cast<VkFormat>(GLIFormat);
+	}
+
+	//!< gli 独自のもの (gli specific ones)
 	switch (GLIFormat) {
 		using enum gli::format;
-	case FORMAT_BGR8_UNORM_PACK32: return VK_FORMAT_A8B8G8R8_UNORM_PACK32;
-	case FORMAT_L8_UNORM_PACK8: return VK_FORMAT_R4G4_UNORM_PACK8;
-	default:
-		assert(true && "Format not found");
-		return VK_FORMAT_UNDEFINED;
+	//!< ETC2 は ETC1 の上位互換 (ETC2 is backward compatible with ETC1)
+	case FORMAT_RGB_ETC_UNORM_BLOCK8: return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+	//!< ルミナンス、アルファはスウィズルで表現する ToVkComponentMapping(gli::format, ...) (Luminance, alpha are expressed by swizzle)
+	case FORMAT_L8_UNORM_PACK8: 
+	case FORMAT_A8_UNORM_PACK8: return VK_FORMAT_R8_UNORM;
+	case FORMAT_LA8_UNORM_PACK8: return VK_FORMAT_R8G8_UNORM;
+	case FORMAT_L16_UNORM_PACK16:
+	case FORMAT_A16_UNORM_PACK16: return VK_FORMAT_R16_UNORM;
+	case FORMAT_LA16_UNORM_PACK16: return VK_FORMAT_R16G16_UNORM;
+	//!< メモリ上は B, G, R, X の順 (B, G, R, X order in memory)
+	case FORMAT_BGR8_UNORM_PACK32: return VK_FORMAT_B8G8R8A8_UNORM;
+	case FORMAT_BGR8_SRGB_PACK32: return VK_FORMAT_B8G8R8A8_SRGB;
+	//!< PVRTC, ATC, RG3B2 等はコアに無い、IsSupportedFormat() で弾かれ、ConvertToSupportedFormat() で変換できなければ GetFallbackGLI() に置き換えられる
+	//!< (PVRTC, ATC, RG3B2 etc. are not in core, rejected by IsSupportedFormat(), replaced by GetFallbackGLI() if ConvertToSupportedFormat() cannot convert)
+	default: return VK_FORMAT_UNDEFINED;
 	}
 }
 VkImageType VK::ToVkImageType(const gli::target GLITarget)
@@ -1189,31 +1777,111 @@ VkComponentMapping VK::ToVkComponentMapping(const gli::texture::swizzles_type GL
 		.b = ToVkComponentSwizzle(GLISwizzleType.b),
 		.a = ToVkComponentSwizzle(GLISwizzleType.a) });
 }
+VkComponentMapping VK::ToVkComponentMapping(const gli::format GLIFormat, const gli::texture::swizzles_type GLISwizzleType)
+{
+	switch (GLIFormat) {
+		using enum gli::format;
+	case FORMAT_L8_UNORM_PACK8:
+	case FORMAT_L16_UNORM_PACK16:
+		return VkComponentMapping({ .r = VK_COMPONENT_SWIZZLE_R, .g = VK_COMPONENT_SWIZZLE_R, .b = VK_COMPONENT_SWIZZLE_R, .a = VK_COMPONENT_SWIZZLE_ONE });
+	case FORMAT_A8_UNORM_PACK8:
+	case FORMAT_A16_UNORM_PACK16:
+		return VkComponentMapping({ .r = VK_COMPONENT_SWIZZLE_ZERO, .g = VK_COMPONENT_SWIZZLE_ZERO, .b = VK_COMPONENT_SWIZZLE_ZERO, .a = VK_COMPONENT_SWIZZLE_R });
+	case FORMAT_LA8_UNORM_PACK8:
+	case FORMAT_LA16_UNORM_PACK16:
+		return VkComponentMapping({ .r = VK_COMPONENT_SWIZZLE_R, .g = VK_COMPONENT_SWIZZLE_R, .b = VK_COMPONENT_SWIZZLE_R, .a = VK_COMPONENT_SWIZZLE_G });
+	case FORMAT_BGR8_UNORM_PACK32:
+	case FORMAT_BGR8_SRGB_PACK32:
+		//!< X は不定なのでアルファは 1 (X is undefined, so alpha is 1)
+		return VkComponentMapping({ .r = VK_COMPONENT_SWIZZLE_R, .g = VK_COMPONENT_SWIZZLE_G, .b = VK_COMPONENT_SWIZZLE_B, .a = VK_COMPONENT_SWIZZLE_ONE });
+	default:
+		return ToVkComponentMapping(GLISwizzleType);
+	}
+}
+bool VK::IsSupportedFormat(const VkFormat Format, const VkFormatFeatureFlags FFF) const
+{
+	if (VK_FORMAT_UNDEFINED == Format) { return false; }
+	VkFormatProperties FP;
+	vkGetPhysicalDeviceFormatProperties(SelectedPhysDevice.first, Format, &FP);
+	return FFF == (FP.optimalTilingFeatures & FFF);
+}
+bool VK::ConvertToSupportedFormat(gli::texture& Gli) const
+{
+	if (IsSupportedFormat(ToVkFormat(Gli.format()), VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT)) { return true; }
+
+	//!< 2D のみ (2D only)
+	if (gli::TARGET_2D != Gli.target()) {
+		std::cerr << "Format " << Gli.format() << " is not supported, and cannot be converted (target " << Gli.target() << " is not 2D)" << std::endl;
+		return false;
+	}
+	const auto Format = gli::is_srgb(Gli.format()) ? gli::FORMAT_RGBA8_SRGB_PACK8 : gli::FORMAT_RGBA8_UNORM_PACK8;
+	if (gli::is_compressed(Gli.format())) {
+		//!< gli::convert() は圧縮フォーマットを扱えないので、ブロックを展開する (gli::convert() cannot handle compressed formats, so decode blocks)
+		if (!BlockDecoder::IsDecodable(Gli.format())) {
+			std::cerr << "Format " << Gli.format() << " is not supported, and cannot be decoded on CPU" << std::endl;
+			return false;
+		}
+		const auto Ext = Gli.extent(0);
+		gli::texture2d Decoded(Format, gli::extent2d(Ext.x, Ext.y), Gli.levels());
+		for (size_t i = 0; i < Gli.levels(); ++i) {
+			const auto LE = Gli.extent(i);
+			BlockDecoder::Decode(Gli.format(), static_cast<const std::byte*>(Gli.data(0, 0, i)), static_cast<uint32_t>(LE.x), static_cast<uint32_t>(LE.y), static_cast<std::byte*>(Decoded.data(0, 0, i)));
+		}
+		std::cout << "Format " << Gli.format() << " is not supported, decoded to " << Format << " on CPU" << std::endl;
+		Gli = Decoded;
+		return true;
+	}
+	std::cout << "Format " << Gli.format() << " is not supported, converted to " << Format << " on CPU" << std::endl;
+	Gli = gli::convert(gli::texture2d(Gli), Format);
+	return true;
+}
+gli::texture VK::GetFallbackGLI()
+{
+	gli::texture2d Gli(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(1, 1), 1);
+	Gli.clear(glm::u8vec4(0xff, 0x00, 0xff, 0xff));
+	return Gli;
+}
 VK::Texture& VK::CreateGLITexture(const std::filesystem::path & Path, gli::texture& Gli)
 {
 	auto& Tex = Textures.emplace_back();
+	Gli = gli::load(std::data(Path.string()));
+	if (!ConvertToSupportedFormat(Gli)) { Gli = GetFallbackGLI(); }
+	CreateGLITexture(Tex, Gli);
+	return Tex;
+}
+void VK::CreateGLITexture(Texture& Tex, const gli::texture& Gli, const uint32_t MipLevels)
+{
+	CreateGLITexture(Tex, Gli.target(), Gli.format(), Gli.extent(0), static_cast<uint32_t>(Gli.layers()) * static_cast<uint32_t>(Gli.faces()), static_cast<uint32_t>(Gli.levels()), MipLevels, ToVkComponentMapping(Gli.format(), Gli.swizzles()));
+}
+void VK::CreateGLITexture(Texture& Tex, const TextureFile& TF, const uint32_t MipLevels)
+{
+	CreateGLITexture(Tex, TF.GetTarget(), TF.GetFormat(), TF.GetExtent(), TF.GetLayers(), TF.GetLevels(), MipLevels, ToVkComponentMapping(TF.GetFormat(), gli::texture::swizzles_type(gli::SWIZZLE_RED, gli::SWIZZLE_GREEN, gli::SWIZZLE_BLUE, gli::SWIZZLE_ALPHA)));
+}
+void VK::CreateGLITexture(Texture& Tex, const gli::target Target, const gli::format Format, const gli::extent3d& Extent, const uint32_t Layers, const uint32_t FileLevels, const uint32_t MipLevels, const VkComponentMapping& CM)
+{
 	auto& Image = Tex.ImageView.first;
 	auto& ImageView = Tex.ImageView.second;
 	auto& DeviceMemory = Tex.DeviceMemory;
 
-	Gli = gli::load(std::data(Path.string()));
+	const auto Levels = 0 == MipLevels ? FileLevels : MipLevels;
 	constexpr std::array<uint32_t, 0> QFIs = {};
 	const VkImageCreateInfo ICI = {
 		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
 		.pNext = nullptr,
-		.flags = static_cast<VkImageCreateFlags>(gli::is_target_cube(Gli.target()) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0),
-		.imageType = ToVkImageType(Gli.target()), 
-		.format = ToVkFormat(Gli.format()),
+		.flags = static_cast<VkImageCreateFlags>(gli::is_target_cube(Target) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0),
+		.imageType = ToVkImageType(Target), 
+		.format = ToVkFormat(Format),
 		.extent = VkExtent3D({
-			.width = static_cast<uint32_t>(Gli.extent(0).x),
-			.height = static_cast<uint32_t>(Gli.extent(0).y),
-			.depth = static_cast<uint32_t>(Gli.extent(0).z)
+			.width = static_cast<uint32_t>(Extent.x),
+			.height = static_cast<uint32_t>(Extent.y),
+			.depth = static_cast<uint32_t>(Extent.z)
 		}),
-		.mipLevels = static_cast<uint32_t>(Gli.levels()),
-		.arrayLayers = static_cast<uint32_t>(Gli.layers()) * static_cast<uint32_t>(Gli.faces()),
+		.mipLevels = Levels,
+		.arrayLayers = Layers,
 		.samples = VK_SAMPLE_COUNT_1_BIT,
 		.tiling = VK_IMAGE_TILING_OPTIMAL,
-		.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		//!< ミップを GPU で作成する場合はブリット元にもなる (Also blit source when generating mips on GPU)
+		.usage = static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | (Levels > FileLevels ? VK_IMAGE_USAGE_TRANSFER_SRC_BIT : 0)),
 		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 		.queueFamilyIndexCount = static_cast<uint32_t>(std::size(QFIs)), .pQueueFamilyIndices = std::data(QFIs),
 		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
@@ -1225,9 +1893,9 @@ VK::Texture& VK::CreateGLITexture(const std::filesystem::path & Path, gli::textu
 		.pNext = nullptr,
 		.flags = 0,
 		.image = Image,
-		.viewType = ToVkImageViewType(Gli.target()),
-		.format = ToVkFormat(Gli.format()),
-		.components = ToVkComponentMapping(Gli.swizzles()),
+		.viewType = ToVkImageViewType(Target),
+		.format = ToVkFormat(Format),
+		.components = CM,
 		.subresourceRange = VkImageSubresourceRange({
 			.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
 			.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
@@ -1235,18 +1903,46 @@ VK::Texture& VK::CreateGLITexture(const std::filesystem::path & Path, gli::textu
 		})
 	};
 	CreateImageView(&ImageView, IVCI);
+}
+uint32_t VK::CreateGLITexture(Texture& Tex, BufferAndDeviceMemory& Staging, std::vector<VkBufferImageCopy2>& BICs, const std::filesystem::path& Path, const bool Mipmap)
+{
+	//!< 2D でミップを持たないもののみ作成する (Generate only for 2D without mips)
+	const auto GetLevels = [&](const gli::target Target, const gli::format Format, const gli::extent3d& Extent, const uint32_t Levels) {
+		return Mipmap && 1 == Levels && gli::TARGET_2D == Target ? GetMipLevels(ToVkFormat(Format), static_cast<uint32_t>(Extent.x), static_cast<uint32_t>(Extent.y)) : Levels;
+	};
 
-	return Tex;
+	if (const TextureFile TF(Path); TF.IsValid() && IsSupportedFormat(ToVkFormat(TF.GetFormat()), VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT)) {
+		const auto Levels = GetLevels(TF.GetTarget(), TF.GetFormat(), TF.GetExtent(), TF.GetLevels());
+		CreateGLITexture(Tex, TF, Levels);
+		CreateHostVisibleBuffer(Staging, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, TF, BICs);
+		return Levels;
+	}
+
+	//!< 解析できない、もしくは CPU での変換が必要な場合 (Not parsable, or conversion on CPU is required)
+	auto Gli = gli::load(std::data(Path.string()));
+	//!< イメージを作成できないフォーマットのまま進まないように、代わりのテクスチャにする (Replace with fallback texture, so as not to proceed with format which image cannot be created with)
+	if (!ConvertToSupportedFormat(Gli)) { Gli = GetFallbackGLI(); }
+	const auto Levels = GetLevels(Gli.target(), Gli.format(), Gli.extent(0), static_cast<uint32_t>(Gli.levels()));
+	CreateGLITexture(Tex, Gli, Levels);
+	CreateHostVisibleBuffer(Staging, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, Gli);
+	GetBufferImageCopies(Gli, BICs);
+	return Levels;
 }
 void VK::CreateGLITextures(const VkCommandBuffer CB, const std::vector<PathAndPipelineStage>& Paths)
 {
-	std::vector<gli::texture> Glis;
-	std::vector<Texture> Texs;
+	std::vector<VkImage> Images;
+	std::vector<std::vector<VkBufferImageCopy2>> BICs;
 	std::vector<BufferAndDeviceMemory> Stgs;
 	for (auto& i : Paths) {
-		Texs.emplace_back(CreateGLITexture(i.first, Glis.emplace_back()));
-		CreateHostVisibleBuffer(Stgs.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, Glis.back());
+		auto& Tex = Textures.emplace_back();
+		CreateGLITexture(Tex, Stgs.emplace_back(), BICs.emplace_back(), i.first);
+		Images.emplace_back(Tex.ImageView.first);
 	}
+	constexpr auto ISR = VkImageSubresourceRange({
+		.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+		.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
+		.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+	});
 	constexpr VkCommandBufferBeginInfo CBBI = {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
 		.pNext = nullptr,
@@ -1256,7 +1952,7 @@ void VK::CreateGLITextures(const VkCommandBuffer CB, const std::vector<PathAndPi
 	VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
 		for (auto Index = 0; auto & i : Paths) {
 			PopulateCopyCommand(CB,
-				Stgs[Index], Texs[Index], Glis[Index], 
+				Stgs[Index].first, Images[Index], BICs[Index], ISR,
 				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, i.second);
 			++Index;
 		}
@@ -1271,9 +1967,14 @@ void VK::CreateGLITextures(const VkCommandBuffer CB, const std::vector<PathAndPi
 }
 
 #ifdef USE_CV
-VK::Texture& VK::CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format)
+VK::Texture& VK::CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format, const uint32_t MipLevels)
 {
 	auto& Tex = Textures.emplace_back();
+	CreateCVTexture(Tex, CvMat, Format, MipLevels);
+	return Tex;
+}
+void VK::CreateCVTexture(Texture& Tex, const cv::Mat& CvMat, const VkFormat Format, const uint32_t MipLevels)
+{
 	auto& Image = Tex.ImageView.first;
 	auto& ImageView = Tex.ImageView.second;
 	auto& DeviceMemory = Tex.DeviceMemory;
@@ -1290,11 +1991,11 @@ VK::Texture& VK::CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format)
 			.height = static_cast<uint32_t>(CvMat.rows),
 			.depth = 1
 		}),
-		.mipLevels = 1,
+		.mipLevels = MipLevels,
 		.arrayLayers = 1,
 		.samples = VK_SAMPLE_COUNT_1_BIT,
 		.tiling = VK_IMAGE_TILING_OPTIMAL,
-		.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		.usage = static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | (1 < MipLevels ? VK_IMAGE_USAGE_TRANSFER_SRC_BIT : 0)),
 		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
 		.queueFamilyIndexCount = static_cast<uint32_t>(std::size(QFIs)), .pQueueFamilyIndices = std::data(QFIs),
 		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
@@ -1321,17 +2022,31 @@ VK::Texture& VK::CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format)
 		})
 	};
 	CreateImageView(&ImageView, IVCI);
-
-	return Tex;
 }
 void VK::CreateCVTextures(const VkCommandBuffer CB, const std::vector<CvMatAndFormatAndPipelineStage>& CvMats)
 {
+	std::vector<const CvMatAndFormatAndPipelineStage*> Uploads;
 	std::vector<Texture> Texs;
 	std::vector<BufferAndDeviceMemory> Stgs;
+	std::vector<uint32_t> Levels;
 	for (auto& i : CvMats) {
-		Texs.emplace_back(CreateCVTexture(i.Mat, i.Format));
+		//!< 同じキーのテクスチャがあればイメージを共有し、アップロードしない (If texture with same key exists, share image and do not upload)
+		//!< 共有元が非同期で読み込み中の場合は、共有せずにアップロードする (If source is being loaded asynchronously, upload without sharing)
+		if (0 != i.Key) {
+			if (const auto It = TextureKeys.find(i.Key); std::end(TextureKeys) != It && !UploadingTextureIndices.contains(It->second)) {
+				const auto Src = It->second;
+				Textures.emplace_back();
+				ShareTexture(std::size(Textures) - 1, Src);
+				continue;
+			}
+			SetTextureKey(std::size(Textures), i.Key);
+		}
+		Uploads.emplace_back(&i);
+		Levels.emplace_back(i.Mipmap ? GetMipLevels(i.Format, static_cast<uint32_t>(i.Mat.cols), static_cast<uint32_t>(i.Mat.rows)) : 1);
+		Texs.emplace_back(CreateCVTexture(i.Mat, i.Format, Levels.back()));
 		CreateHostVisibleBuffer(Stgs.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, i.Mat);
 	}
+	if (std::empty(Uploads)) { return; }
 	constexpr VkCommandBufferBeginInfo CBBI = {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
 		.pNext = nullptr,
@@ -1339,10 +2054,21 @@ void VK::CreateCVTextures(const VkCommandBuffer CB, const std::vector<CvMatAndFo
 		.pInheritanceInfo = nullptr
 	};
 	VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
-		for (auto Index = 0; auto & i : CvMats) {
-			PopulateCopyCommand(CB, 
-				Stgs[Index], Texs[Index], i.Mat, 
-				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, i.PipelineStage);
+		for (auto Index = 0; auto i : Uploads) {
+			if (1 < Levels[Index]) {
+				//!< レベル 0 へコピーした後、ブリットでミップを作成する (Copy to level 0, then generate mips by blit)
+				PopulateCopyCommand(CB,
+					Stgs[Index], Texs[Index], i->Mat,
+					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_2_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT);
+				PopulateMipmapCommand(CB,
+					Texs[Index].ImageView.first, static_cast<uint32_t>(i->Mat.cols), static_cast<uint32_t>(i->Mat.rows), Levels[Index],
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, i->PipelineStage);
+			}
+			else {
+				PopulateCopyCommand(CB, 
+					Stgs[Index], Texs[Index], i->Mat, 
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, i->PipelineStage);
+			}
 			++Index;
 		}
 	} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
@@ -1356,6 +2082,268 @@ void VK::CreateCVTextures(const VkCommandBuffer CB, const std::vector<CvMatAndFo
 }
 #endif
 
+VK::Texture& VK::CreatePlaceholderTexture(const VkCommandBuffer CB, const VkClearColorValue& Color, const VkPipelineStageFlags2 PSF)
+{
+	auto& Tex = CreateTexture(VK_FORMAT_R8G8B8A8_UNORM, 1, 1, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+
+	constexpr VkCommandBufferBeginInfo CBBI = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = nullptr,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = nullptr
+	};
+	VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
+		constexpr auto ISR = VkImageSubresourceRange({
+			.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+			.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
+			.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+		});
+		ImageMemoryBarrier(CB, Tex.ImageView.first,
+			VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_2_CLEAR_BIT,
+			VK_ACCESS_2_NONE, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+			VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		const std::array ISRs = { ISR };
+		vkCmdClearColorImage(CB, Tex.ImageView.first, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &Color, static_cast<uint32_t>(std::size(ISRs)), std::data(ISRs));
+		ImageMemoryBarrier(CB, Tex.ImageView.first,
+			VK_PIPELINE_STAGE_2_CLEAR_BIT, PSF,
+			VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
+
+	SubmitAndWait(CB);
+
+	return Tex;
+}
+JobSystem::JobHandle VK::CreateGLITextureAsync(const size_t Index, const std::filesystem::path& Path, const VkPipelineStageFlags2 PSF, const bool Mipmap)
+{
+	SetTextureKey(Index, 0);
+	UploadingTextureIndices.emplace(Index);
+
+	//!< 描画を妨げないようにバックグラウンドで実行する (Run in background so as not to disturb rendering)
+	auto Job = JobSystem::Get().ScheduleBackground([this, Index, Path, PSF, Mipmap] {
+		Texture Tex;
+		std::vector<VkBufferImageCopy2> BICs;
+		const auto Levels = CreateGLITexture(Tex, Tex.Staging.emplace_back(), BICs, Path, Mipmap);
+		const auto Staging = Tex.Staging.back();
+		const auto Image = Tex.ImageView.first;
+		constexpr auto ISR = VkImageSubresourceRange({
+			.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+			.baseMipLevel = 0, .levelCount = VK_REMAINING_MIP_LEVELS,
+			.baseArrayLayer = 0, .layerCount = VK_REMAINING_ARRAY_LAYERS
+		});
+		SubmitTextureUpload(Index, std::move(Tex), [&](const VkCommandBuffer CB) {
+			//!< ミップを作成するのは 2D で 1 レベルのもののみ (Mips are generated only for 2D with single level)
+			if (1 < Levels && 1 == std::size(BICs)) {
+				PopulateCopyCommand(CB,
+					Staging.first, Image, BICs, ISR,
+					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_2_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT);
+				PopulateMipmapCommand(CB,
+					Image, BICs.front().imageExtent.width, BICs.front().imageExtent.height, Levels,
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, PSF);
+			}
+			else {
+				PopulateCopyCommand(CB, 
+					Staging.first, Image, BICs, ISR,
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, PSF);
+			}
+		});
+	});
+	std::lock_guard Lock(TextureUploadMutex);
+	return TextureUploadJobs.emplace_back(Job);
+}
+#ifdef USE_CV
+JobSystem::JobHandle VK::CreateCVTextureAsync(const size_t Index, std::function<cv::Mat()>&& Decode, const VkFormat Format, const VkPipelineStageFlags2 PSF, const bool Mipmap, const size_t Key)
+{
+	//!< 同じキーのテクスチャがあればデコード、アップロードせずに共有する (If texture with same key exists, share without decode and upload)
+	if (0 != Key) {
+		if (const auto It = TextureKeys.find(Key); std::end(TextureKeys) != It && Index != It->second) {
+			const auto Src = It->second;
+			SetTextureKey(Index, 0);
+			if (UploadingTextureIndices.contains(Src)) {
+				//!< 共有元の差し替え時に共有する (Share when source is replaced)
+				PendingTextureShares.emplace_back(Src, Index);
+			}
+			else {
+				ShareTexture(Index, Src);
+			}
+			return nullptr;
+		}
+	}
+	SetTextureKey(Index, Key);
+	UploadingTextureIndices.emplace(Index);
+
+	auto Job = JobSystem::Get().ScheduleBackground([this, Index, Decode = std::move(Decode), Format, PSF, Mipmap] {
+		const auto CvMat = Decode();
+		const auto W = static_cast<uint32_t>(CvMat.cols), H = static_cast<uint32_t>(CvMat.rows);
+		const auto Levels = Mipmap ? GetMipLevels(Format, W, H) : 1;
+		Texture Tex;
+		CreateCVTexture(Tex, CvMat, Format, Levels);
+		CreateHostVisibleBuffer(Tex.Staging.emplace_back(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, CvMat);
+		const auto Staging = Tex.Staging.back();
+		const auto Image = Tex.ImageView.first;
+		SubmitTextureUpload(Index, std::move(Tex), [&](const VkCommandBuffer CB) {
+			if (1 < Levels) {
+				PopulateCopyCommand(CB,
+					Staging.first, Image, CvMat,
+					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_2_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT);
+				PopulateMipmapCommand(CB,
+					Image, W, H, Levels,
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, PSF);
+			}
+			else {
+				PopulateCopyCommand(CB,
+					Staging.first, Image, CvMat,
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_2_SHADER_READ_BIT, PSF);
+			}
+		});
+	});
+	std::lock_guard Lock(TextureUploadMutex);
+	return TextureUploadJobs.emplace_back(Job);
+}
+#endif
+bool VK::IsUploadingTexture()
+{
+	std::lock_guard Lock(TextureUploadMutex);
+	return !std::empty(TextureUploads) || std::ranges::any_of(TextureUploadJobs, [](const auto& rhs) { return !rhs->IsDone(); });
+}
+void VK::DestroyTexture(Texture& Tex) const
+{
+	for (auto i : Tex.Staging) {
+		vkFreeMemory(Device, i.second, nullptr);
+		vkDestroyBuffer(Device, i.first, nullptr);
+	}
+	Tex.Staging.clear();
+	//!< 他に参照があればイメージは破棄しない (Image is not destroyed if other references exist)
+	const auto IsReferenced = nullptr != Tex.SharedImage && 1 < Tex.SharedImage.use_count();
+	Tex.SharedImage.reset();
+	if (!IsReferenced) {
+		vkFreeMemory(Device, Tex.DeviceMemory, nullptr);
+		vkDestroyImageView(Device, Tex.ImageView.second, nullptr);
+		vkDestroyImage(Device, Tex.ImageView.first, nullptr);
+	}
+	Tex.ImageView = ImageAndView({ VK_NULL_HANDLE, VK_NULL_HANDLE });
+	Tex.DeviceMemory = VK_NULL_HANDLE;
+}
+void VK::ShareTexture(const size_t Dst, const size_t Src)
+{
+	auto& Owner = Textures[Src];
+	if (nullptr == Owner.SharedImage) {
+		Owner.SharedImage = std::make_shared<const ImageAndView>(Owner.ImageView);
+	}
+	auto& Tex = Textures[Dst];
+	DestroyTexture(Tex);
+	Tex.ImageView = Owner.ImageView;
+	Tex.DeviceMemory = Owner.DeviceMemory;
+	Tex.SharedImage = Owner.SharedImage;
+}
+void VK::SetTextureKey(const size_t Index, const size_t Key)
+{
+	std::erase_if(TextureKeys, [&](const auto& rhs) { return Index == rhs.second; });
+	if (0 != Key) { TextureKeys[Key] = Index; }
+}
+void VK::SubmitTextureUpload(const size_t Index, Texture&& Tex, std::function<void(const VkCommandBuffer)>&& Populate)
+{
+	//!< コマンドプールは外部同期が必要なので、アップロード毎に作成する (Command pool must be externally synchronized, so create per upload)
+	auto Upload = TextureUpload({ .Index = Index, .Tex = std::move(Tex), .CommandPool = VK_NULL_HANDLE, .TimelineValue = 0 });
+	const VkCommandPoolCreateInfo CPCI = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.pNext = nullptr,
+		.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+		.queueFamilyIndex = GraphicsQueue.second
+	};
+	VERIFY_SUCCEEDED(vkCreateCommandPool(Device, &CPCI, nullptr, &Upload.CommandPool));
+	VkCommandBuffer CB;
+	AllocateCommandBuffers(1, &CB, Upload.CommandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+	constexpr VkCommandBufferBeginInfo CBBI = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = nullptr,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = nullptr
+	};
+	VERIFY_SUCCEEDED(vkBeginCommandBuffer(CB, &CBBI)); {
+		Populate(CB);
+	} VERIFY_SUCCEEDED(vkEndCommandBuffer(CB));
+
+	{
+		//!< サブミット順とタイムライン値の順が一致するように、値の発行もロック内で行う (Issue value inside lock, so that submission order matches timeline value order)
+		std::lock_guard Lock(QueueMutex);
+		Upload.TimelineValue = ++UploadSemaphoreValue;
+
+		const std::array<VkSemaphoreSubmitInfo, 0> WaitSSIs = {};
+		const std::array CBSIs = {
+			VkCommandBufferSubmitInfo({
+				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+				.pNext = nullptr,
+				.commandBuffer = CB,
+				.deviceMask = 0
+				})
+		};
+		const std::array SignalSSIs = {
+			VkSemaphoreSubmitInfo({
+				.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+				.pNext = nullptr,
+				.semaphore = UploadSemaphore,
+				.value = Upload.TimelineValue,
+				.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+				.deviceIndex = 0
+				})
+		};
+		const std::array SIs = {
+			VkSubmitInfo2({
+				.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+				.pNext = nullptr,
+				.flags = 0,
+				.waitSemaphoreInfoCount = static_cast<uint32_t>(std::size(WaitSSIs)), .pWaitSemaphoreInfos = std::data(WaitSSIs),
+				.commandBufferInfoCount = static_cast<uint32_t>(std::size(CBSIs)), .pCommandBufferInfos = std::data(CBSIs),
+				.signalSemaphoreInfoCount = static_cast<uint32_t>(std::size(SignalSSIs)), .pSignalSemaphoreInfos = std::data(SignalSSIs)
+			})
+		};
+		VERIFY_SUCCEEDED(vkQueueSubmit2(GraphicsQueue.first, static_cast<uint32_t>(std::size(SIs)), std::data(SIs), VK_NULL_HANDLE));
+	}
+
+	std::lock_guard Lock(TextureUploadMutex);
+	TextureUploads.emplace_back(std::move(Upload));
+}
+bool VK::SwapUploadedTextures()
+{
+	std::vector<TextureUpload> Uploaded;
+	{
+		std::lock_guard Lock(TextureUploadMutex);
+		if (std::empty(TextureUploads)) { return false; }
+
+		//!< 待たずに現在のタイムライン値を取得する (Get current timeline value without waiting)
+		uint64_t Value;
+		VERIFY_SUCCEEDED(vkGetSemaphoreCounterValue(Device, UploadSemaphore, &Value));
+		const auto It = std::ranges::partition(TextureUploads, [&](const auto& rhs) { return rhs.TimelineValue > Value; }).begin();
+		std::move(It, std::end(TextureUploads), std::back_inserter(Uploaded));
+		TextureUploads.erase(It, std::end(TextureUploads));
+	}
+	if (std::empty(Uploaded)) { return false; }
+
+	//!< フェンスを待った後に呼ばれるので、プレースホルダは GPU から参照されていない (Called after waiting fence, placeholders are not referenced by GPU)
+	for (auto& i : Uploaded) {
+		DestroyTexture(Textures[i.Index]);
+		for (auto j : i.Tex.Staging) {
+			vkFreeMemory(Device, j.second, nullptr);
+			vkDestroyBuffer(Device, j.first, nullptr);
+		}
+		i.Tex.Staging.clear();
+		vkDestroyCommandPool(Device, i.CommandPool, nullptr);
+		Textures[i.Index] = std::move(i.Tex);
+		UploadingTextureIndices.erase(i.Index);
+
+		//!< 差し替わったテクスチャを待っていた共有を行う (Perform shares waiting for replaced texture)
+		std::erase_if(PendingTextureShares, [&](const auto& rhs) {
+			if (i.Index != rhs.first) { return false; }
+			ShareTexture(rhs.second, rhs.first);
+			return true;
+		});
+	}
+	UpdateTextureDescriptor();
+	return true;
+}
+
 void VK::CreateRenderPass(const VkAttachmentLoadOp ALO, const VkAttachmentStoreOp ASO,
 	const VkImageLayout Init, const VkImageLayout Final)
 {
@@ -1439,12 +2427,27 @@ void VK::CreatePipeline(VkPipeline& PL,
 	const VkPipelineColorBlendStateCreateInfo& PCBSCI,
 	const VkPipelineDynamicStateCreateInfo& PDSCI,
 	const VkPipelineLayout PLL,
-	const VkRenderPass RP)
+	const VkRenderPass RP,
+	const VkPipelineRenderingCreateInfo* PRCI)
 {
+	if (HasGraphicsPipelineLibrary) {
+		CreatePipeline_Library(PL, PSSCIs, PVISCI, PIASCI, PTSCI, PVSCI, PRSCI, PMSCI, PDSSCI, PCBSCI, PDSCI, PLL, RP, PRCI);
+		return;
+	}
+
+	//!< パイプライン作成のフィードバック (時間、キャッシュヒット) (Pipeline creation feedback (duration, cache hit))
+	VkPipelineCreationFeedback PCF = {};
+	std::vector<VkPipelineCreationFeedback> StagePCFs(std::size(PSSCIs));
+	const VkPipelineCreationFeedbackCreateInfo PCFCI = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+		.pNext = PRCI,
+		.pPipelineCreationFeedback = &PCF,
+		.pipelineStageCreationFeedbackCount = static_cast<uint32_t>(std::size(StagePCFs)), .pPipelineStageCreationFeedbacks = std::data(StagePCFs)
+	};
 	const std::array GPCIs = {
 		VkGraphicsPipelineCreateInfo({
 			.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-			.pNext = nullptr,
+			.pNext = &PCFCI,
 #ifdef _DEBUG
 			.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT,
 #else
@@ -1465,33 +2468,410 @@ void VK::CreatePipeline(VkPipeline& PL,
 			.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
 		})
 	};
-	VERIFY_SUCCEEDED(vkCreateGraphicsPipelines(Device, VK_NULL_HANDLE, static_cast<uint32_t>(std::size(GPCIs)), std::data(GPCIs), nullptr, &PL));
+	VERIFY_SUCCEEDED(vkCreateGraphicsPipelines(Device, PipelineCache, static_cast<uint32_t>(std::size(GPCIs)), std::data(GPCIs), nullptr, &PL));
+
+	LogPipelineCreationFeedback(PCF, StagePCFs);
+}
+void VK::CreatePipeline_Compute(VkPipeline& PL, const VkShaderModule SM, const VkPipelineLayout PLL, const VkSpecializationInfo* SI)
+{
+	VkPipelineCreationFeedback PCF = {};
+	std::array<VkPipelineCreationFeedback, 1> StagePCFs = {};
+	const VkPipelineCreationFeedbackCreateInfo PCFCI = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+		.pNext = nullptr,
+		.pPipelineCreationFeedback = &PCF,
+		.pipelineStageCreationFeedbackCount = static_cast<uint32_t>(std::size(StagePCFs)), .pPipelineStageCreationFeedbacks = std::data(StagePCFs)
+	};
+	const std::array CPCIs = {
+		VkComputePipelineCreateInfo({
+			.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+			.pNext = &PCFCI,
+#ifdef _DEBUG
+			.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT,
+#else
+			.flags = 0,
+#endif
+			.stage = VkPipelineShaderStageCreateInfo({
+				.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+				.pNext = nullptr,
+				.flags = 0,
+				.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+				.module = SM,
+				.pName = "main",
+				.pSpecializationInfo = SI
+			}),
+			.layout = PLL,
+			.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+		})
+	};
+	VERIFY_SUCCEEDED(vkCreateComputePipelines(Device, PipelineCache, static_cast<uint32_t>(std::size(CPCIs)), std::data(CPCIs), nullptr, &PL));
+
+	LogPipelineCreationFeedback(PCF, StagePCFs);
+}
+void VK::LogPipelineCreationFeedback(const VkPipelineCreationFeedback& PCF, std::span<const VkPipelineCreationFeedback> StagePCFs)
+{
+	if (!(VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT & PCF.flags)) { return; }
+
+	const auto ToMS = [](const uint64_t NS) { return static_cast<double>(NS) / 1000000.0; };
+	const auto IsHit = [](const VkPipelineCreationFeedback& rhs) { return (VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT & rhs.flags) ? "Hit" : "Miss"; };
+
+	//!< 複数スレッドから呼ばれるので 1 回で出力する (Called from multiple threads, output at once)
+	std::stringstream SS;
+	SS << "Pipeline created : " << ToMS(PCF.duration) << " ms, Cache " << IsHit(PCF) << " [";
+	for (const auto& i : StagePCFs) {
+		if (VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT & i.flags) {
+			SS << " " << ToMS(i.duration) << " ms " << IsHit(i) << ",";
+		}
+	}
+	SS << " ]" << std::endl;
+	std::cout << SS.str();
+}
+void VK::CreatePipeline_Library(VkPipeline& PL,
+	const std::vector<VkPipelineShaderStageCreateInfo>& PSSCIs,
+	const VkPipelineVertexInputStateCreateInfo& PVISCI,
+	const VkPipelineInputAssemblyStateCreateInfo& PIASCI,
+	const VkPipelineTessellationStateCreateInfo& PTSCI,
+	const VkPipelineViewportStateCreateInfo& PVSCI,
+	const VkPipelineRasterizationStateCreateInfo& PRSCI,
+	const VkPipelineMultisampleStateCreateInfo& PMSCI,
+	const VkPipelineDepthStencilStateCreateInfo& PDSSCI,
+	const VkPipelineColorBlendStateCreateInfo& PCBSCI,
+	const VkPipelineDynamicStateCreateInfo& PDSCI,
+	const VkPipelineLayout PLL,
+	const VkRenderPass RP,
+	const VkPipelineRenderingCreateInfo* PRCI)
+{
+	//!< ライブラリのキーは各パーツに影響するステートの内容から作る (Library key is made from contents of states which affect each part)
+	const auto HashDynamicState = [&](size_t Key) {
+		for (uint32_t i = 0; i < PDSCI.dynamicStateCount; ++i) { Key = HashCombine(Key, PDSCI.pDynamicStates[i]); }
+		return Key;
+	};
+	const auto HashStage = [&](size_t Key, const VkPipelineShaderStageCreateInfo& PSSCI) {
+		Key = HashCombine(Key, PSSCI.stage);
+		Key = HashCombine(Key, GetShaderModuleHash(PSSCI.module));
+		Key = HashBytes(Key, std::as_bytes(std::span(PSSCI.pName, std::strlen(PSSCI.pName))));
+		if (nullptr != PSSCI.pSpecializationInfo) {
+			const auto SI = PSSCI.pSpecializationInfo;
+			for (uint32_t i = 0; i < SI->mapEntryCount; ++i) { Key = HashCombine(Key, SI->pMapEntries[i]); }
+			Key = HashBytes(Key, std::span(static_cast<const std::byte*>(SI->pData), SI->dataSize));
+		}
+		return Key;
+	};
+	const auto HashRendering = [&](size_t Key) {
+		if (nullptr != PRCI) {
+			Key = HashCombine(Key, PRCI->viewMask);
+			Key = HashBytes(Key, std::as_bytes(std::span(PRCI->pColorAttachmentFormats, PRCI->colorAttachmentCount)));
+			Key = HashCombine(Key, PRCI->depthAttachmentFormat);
+			Key = HashCombine(Key, PRCI->stencilAttachmentFormat);
+		}
+		return Key;
+	};
+	const auto HashMultisample = [&](size_t Key) {
+		Key = HashCombine(Key, PMSCI.rasterizationSamples);
+		Key = HashCombine(Key, PMSCI.sampleShadingEnable);
+		Key = HashCombine(Key, PMSCI.minSampleShading);
+		Key = HashCombine(Key, nullptr != PMSCI.pSampleMask ? *PMSCI.pSampleMask : 0xffffffff);
+		Key = HashCombine(Key, PMSCI.alphaToCoverageEnable);
+		return HashCombine(Key, PMSCI.alphaToOneEnable);
+	};
+
+	std::vector<VkPipelineShaderStageCreateInfo> PreRasterPSSCIs, FragmentPSSCIs;
+	for (const auto& i : PSSCIs) {
+		(VK_SHADER_STAGE_FRAGMENT_BIT == i.stage ? FragmentPSSCIs : PreRasterPSSCIs).emplace_back(i);
+	}
+
+	//!< 頂点入力 (Vertex input interface)
+	auto Key = HashCombine(HashSeed, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+	for (uint32_t i = 0; i < PVISCI.vertexBindingDescriptionCount; ++i) { Key = HashCombine(Key, PVISCI.pVertexBindingDescriptions[i]); }
+	for (uint32_t i = 0; i < PVISCI.vertexAttributeDescriptionCount; ++i) { Key = HashCombine(Key, PVISCI.pVertexAttributeDescriptions[i]); }
+	Key = HashCombine(Key, PIASCI.topology);
+	Key = HashCombine(Key, PIASCI.primitiveRestartEnable);
+	const auto VertexInput = CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, HashDynamicState(Key), VkGraphicsPipelineCreateInfo({
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pVertexInputState = &PVISCI,
+		.pInputAssemblyState = &PIASCI,
+		.pDynamicState = &PDSCI,
+		.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+	}));
+
+	//!< プリラスタライゼーション (テッセレーション、ジオメトリシェーダを含む高コストな部分) (Pre-rasterization (expensive part including tessellation, geometry shader))
+	Key = HashCombine(HashSeed, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+	for (const auto& i : PreRasterPSSCIs) { Key = HashStage(Key, i); }
+	Key = HashCombine(Key, PTSCI.patchControlPoints);
+	Key = HashCombine(Key, PVSCI.viewportCount);
+	Key = HashCombine(Key, PVSCI.scissorCount);
+	Key = HashCombine(Key, PRSCI.depthClampEnable);
+	Key = HashCombine(Key, PRSCI.rasterizerDiscardEnable);
+	Key = HashCombine(Key, PRSCI.polygonMode);
+	Key = HashCombine(Key, PRSCI.cullMode);
+	Key = HashCombine(Key, PRSCI.frontFace);
+	Key = HashCombine(Key, PRSCI.depthBiasEnable);
+	Key = HashCombine(Key, PRSCI.depthBiasConstantFactor);
+	Key = HashCombine(Key, PRSCI.depthBiasClamp);
+	Key = HashCombine(Key, PRSCI.depthBiasSlopeFactor);
+	Key = HashCombine(Key, PRSCI.lineWidth);
+	Key = HashCombine(Key, PLL);
+	Key = HashCombine(Key, RP);
+	const auto PreRasterization = CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, HashRendering(HashDynamicState(Key)), VkGraphicsPipelineCreateInfo({
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pNext = PRCI,
+		.stageCount = static_cast<uint32_t>(std::size(PreRasterPSSCIs)), .pStages = std::data(PreRasterPSSCIs),
+		.pTessellationState = &PTSCI,
+		.pViewportState = &PVSCI,
+		.pRasterizationState = &PRSCI,
+		.pDynamicState = &PDSCI,
+		.layout = PLL,
+		.renderPass = RP, .subpass = 0,
+		.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+	}));
+
+	//!< フラグメントシェーダ (Fragment shader)
+	Key = HashCombine(HashSeed, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+	for (const auto& i : FragmentPSSCIs) { Key = HashStage(Key, i); }
+	Key = HashCombine(Key, PDSSCI.depthTestEnable);
+	Key = HashCombine(Key, PDSSCI.depthWriteEnable);
+	Key = HashCombine(Key, PDSSCI.depthCompareOp);
+	Key = HashCombine(Key, PDSSCI.depthBoundsTestEnable);
+	Key = HashCombine(Key, PDSSCI.stencilTestEnable);
+	Key = HashCombine(Key, PDSSCI.front);
+	Key = HashCombine(Key, PDSSCI.back);
+	Key = HashCombine(Key, PDSSCI.minDepthBounds);
+	Key = HashCombine(Key, PDSSCI.maxDepthBounds);
+	Key = HashMultisample(Key);
+	Key = HashCombine(Key, PLL);
+	Key = HashCombine(Key, RP);
+	const auto FragmentShader = CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, HashRendering(HashDynamicState(Key)), VkGraphicsPipelineCreateInfo({
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pNext = PRCI,
+		.stageCount = static_cast<uint32_t>(std::size(FragmentPSSCIs)), .pStages = std::data(FragmentPSSCIs),
+		.pMultisampleState = &PMSCI,
+		.pDepthStencilState = &PDSSCI,
+		.pDynamicState = &PDSCI,
+		.layout = PLL,
+		.renderPass = RP, .subpass = 0,
+		.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+	}));
+
+	//!< フラグメント出力 (Fragment output interface)
+	Key = HashCombine(HashSeed, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+	Key = HashCombine(Key, PCBSCI.logicOpEnable);
+	Key = HashCombine(Key, PCBSCI.logicOp);
+	for (uint32_t i = 0; i < PCBSCI.attachmentCount; ++i) { Key = HashCombine(Key, PCBSCI.pAttachments[i]); }
+	Key = HashBytes(Key, std::as_bytes(std::span(PCBSCI.blendConstants)));
+	Key = HashMultisample(Key);
+	Key = HashCombine(Key, RP);
+	const auto FragmentOutput = CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, HashRendering(HashDynamicState(Key)), VkGraphicsPipelineCreateInfo({
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pNext = PRCI,
+		.pMultisampleState = &PMSCI,
+		.pColorBlendState = &PCBSCI,
+		.pDynamicState = &PDSCI,
+		.renderPass = RP, .subpass = 0,
+		.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+	}));
+
+	//!< まずは高速リンクで作成 (Create with fast link first)
+	const std::array Libraries = { VertexInput, PreRasterization, FragmentShader, FragmentOutput };
+	PL = LinkPipeline(Libraries, PLL, RP, false);
+
+	//!< 最適化リンクはバックグラウンドで行い、完了したら SwapOptimizedPipelines() で差し替える (Optimized link in background, swapped by SwapOptimizedPipelines() when done)
+	const auto Fast = PL;
+	{
+		std::lock_guard Lock(OptimizedPipelineMutex);
+		LinkingPipelines.emplace(Fast);
+	}
+	auto Job = JobSystem::Get().ScheduleBackground([this, Libraries, PLL, RP, Fast] {
+		const auto Optimized = LinkPipeline(Libraries, PLL, RP, true);
+		std::lock_guard Lock(OptimizedPipelineMutex);
+		LinkingPipelines.erase(Fast);
+		//!< リンク中に不要になった (Became unnecessary while linking)
+		if (0 != RetiredPipelines.erase(Fast)) {
+			vkDestroyPipeline(Device, Optimized, nullptr);
+			vkDestroyPipeline(Device, Fast, nullptr);
+			return;
+		}
+		OptimizedPipelines[Fast] = Optimized;
+	});
+	std::lock_guard Lock(OptimizedPipelineMutex);
+	PipelineLinkJobs.emplace_back(std::move(Job));
+}
+VkPipeline VK::CreatePipelineLibrary(const VkGraphicsPipelineLibraryFlagsEXT GPLF, const size_t Key, VkGraphicsPipelineCreateInfo GPCI)
+{
+	{
+		std::lock_guard Lock(PipelineLibraryMutex);
+		if (const auto It = PipelineLibraries.find(Key); std::end(PipelineLibraries) != It) {
+			return It->second.Pipeline;
+		}
+	}
+
+	//!< 呼び出し側の pNext (VkPipelineRenderingCreateInfo 等) は後ろにつなぐ (Caller's pNext (VkPipelineRenderingCreateInfo etc.) is chained after)
+	const VkGraphicsPipelineLibraryCreateInfoEXT GPLCI = {
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+		.pNext = const_cast<void*>(GPCI.pNext),
+		.flags = GPLF
+	};
+	GPCI.pNext = &GPLCI;
+	//!< 後で最適化リンクできるように情報を保持しておく (Retain information for later optimized link)
+	GPCI.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+	VkPipeline PL;
+	VERIFY_SUCCEEDED(vkCreateGraphicsPipelines(Device, PipelineCache, 1, &GPCI, nullptr, &PL));
+
+	//!< 別スレッドが同じライブラリを先に作成していたらそちらを使う (If other thread has created same library first, use it)
+	std::lock_guard Lock(PipelineLibraryMutex);
+	const auto [It, Inserted] = PipelineLibraries.emplace(Key, PipelineLibrary({ .Pipeline = PL, .Layout = GPCI.layout, .RenderPass = GPCI.renderPass }));
+	if (!Inserted) {
+		vkDestroyPipeline(Device, PL, nullptr);
+	}
+	return It->second.Pipeline;
+}
+void VK::EvictPipelineLibraries(const VkPipelineLayout PLL, const VkRenderPass RP)
+{
+	//!< 最適化リンク中のライブラリは破棄できないので完了を待つ (Libraries being linked cannot be destroyed, so wait for completion)
+	std::vector<JobSystem::JobHandle> Jobs;
+	{
+		std::lock_guard Lock(OptimizedPipelineMutex);
+		Jobs = PipelineLinkJobs;
+	}
+	JobSystem::Get().Wait(Jobs);
+
+	std::lock_guard Lock(PipelineLibraryMutex);
+	std::erase_if(PipelineLibraries, [&](const auto& rhs) {
+		const auto& Lib = rhs.second;
+		if ((VK_NULL_HANDLE != PLL && PLL == Lib.Layout) || (VK_NULL_HANDLE != RP && RP == Lib.RenderPass)) {
+			vkDestroyPipeline(Device, Lib.Pipeline, nullptr);
+			return true;
+		}
+		return false;
+	});
+}
+VkPipeline VK::LinkPipeline(std::span<const VkPipeline> Libraries, const VkPipelineLayout PLL, const VkRenderPass RP, const bool Optimize)
+{
+	const VkPipelineLibraryCreateInfoKHR PLCI = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+		.pNext = nullptr,
+		.libraryCount = static_cast<uint32_t>(std::size(Libraries)), .pLibraries = std::data(Libraries)
+	};
+	VkPipelineCreationFeedback PCF = {};
+	const VkPipelineCreationFeedbackCreateInfo PCFCI = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+		.pNext = &PLCI,
+		.pPipelineCreationFeedback = &PCF,
+		.pipelineStageCreationFeedbackCount = 0, .pPipelineStageCreationFeedbacks = nullptr
+	};
+	const VkGraphicsPipelineCreateInfo GPCI = {
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pNext = &PCFCI,
+		.flags = Optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0,
+		.stageCount = 0, .pStages = nullptr,
+		.layout = PLL,
+		.renderPass = RP, .subpass = 0,
+		.basePipelineHandle = VK_NULL_HANDLE, .basePipelineIndex = -1
+	};
+	VkPipeline PL;
+	VERIFY_SUCCEEDED(vkCreateGraphicsPipelines(Device, PipelineCache, 1, &GPCI, nullptr, &PL));
+
+	//!< 高速リンクの結果は他のデバイスでの作成と同様に常に出力する、バックグラウンドの最適化リンクはデバッグ時のみ
+	//!< (Fast link result is always output like creation on other devices, background optimized link only in debug)
+#ifdef _DEBUG
+	constexpr auto LogOptimized = true;
+#else
+	constexpr auto LogOptimized = false;
+#endif
+	if (!Optimize || LogOptimized) {
+		LogPipelineCreationFeedback(PCF, {});
+	}
+	return PL;
+}
+bool VK::SwapOptimizedPipelines()
+{
+	std::lock_guard Lock(OptimizedPipelineMutex);
+	if (std::empty(OptimizedPipelines)) { return false; }
+
+	auto Swapped = false;
+	for (auto& i : Pipelines) {
+		if (const auto It = OptimizedPipelines.find(i); std::end(OptimizedPipelines) != It) {
+			vkDestroyPipeline(Device, i, nullptr);
+			i = It->second;
+			OptimizedPipelines.erase(It);
+			Swapped = true;
+		}
+	}
+	return Swapped;
+}
+void VK::RecreatePipeline()
+{
+	PipelineRecreateJob = JobSystem::Get().ScheduleBackground([this] {
+		std::vector<VkPipeline> PLs;
+		CreatePipeline(PLs);
+
+		std::vector<VkPipeline> Unused;
+		{
+			std::lock_guard Lock(RecreatedPipelineMutex);
+			Unused.swap(RecreatedPipelines);
+			RecreatedPipelines = std::move(PLs);
+		}
+		//!< 差し替え前に再度作り直された場合、前回の分は GPU から参照されていない (If recreated again before swap, previous ones are not referenced by GPU)
+		for (auto i : Unused) {
+			RetirePipeline(i);
+		}
+	});
+}
+bool VK::SwapRecreatedPipelines()
+{
+	std::vector<VkPipeline> PLs;
+	{
+		std::lock_guard Lock(RecreatedPipelineMutex);
+		if (std::empty(RecreatedPipelines)) { return false; }
+		PLs.swap(RecreatedPipelines);
+	}
+	//!< フェンスを待った後に呼ばれるので、古いパイプラインは GPU から参照されていない (Called after waiting fence, old pipelines are not referenced by GPU)
+	for (auto i : Pipelines) {
+		RetirePipeline(i);
+	}
+	Pipelines = std::move(PLs);
+	return true;
+}
+void VK::RetirePipeline(const VkPipeline PL)
+{
+	std::lock_guard Lock(OptimizedPipelineMutex);
+	if (const auto It = OptimizedPipelines.find(PL); std::end(OptimizedPipelines) != It) {
+		//!< 最適化リンク済みで未差し替えのもの (Optimized linked, but not swapped yet)
+		vkDestroyPipeline(Device, It->second, nullptr);
+		OptimizedPipelines.erase(It);
+	}
+	else if (LinkingPipelines.contains(PL)) {
+		RetiredPipelines.emplace(PL);
+		return;
+	}
+	vkDestroyPipeline(Device, PL, nullptr);
 }
 void VK::CreatePipeline(VkPipeline& PL, 
 	const VkShaderModule VS, const VkShaderModule FS, const VkShaderModule TES, const VkShaderModule TCS, const VkShaderModule GS,
 	const std::vector<VkVertexInputBindingDescription>& VIBDs, const std::vector<VkVertexInputAttributeDescription>& VIADs,
 	const VkPrimitiveTopology PT,
 	const uint32_t PatchControlPoints,
-	const VkPolygonMode PM, const VkCullModeFlags CMF, const VkFrontFace FF,
-	const VkBool32 DepthEnable,
+	const VkPolygonMode PM, [[maybe_unused]] const VkCullModeFlags CMF, [[maybe_unused]] const VkFrontFace FF,
+	[[maybe_unused]] const VkBool32 DepthEnable,
 	const VkPipelineLayout PLL,
-	const VkRenderPass RP) 
+	const VkRenderPass RP,
+	const SpecializationInfos& SIs,
+	const VkPipelineRenderingCreateInfo* PRCI) 
 {
 	std::vector<VkPipelineShaderStageCreateInfo> PSSCIs;
 	if (VK_NULL_HANDLE != VS) {
-		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_VERTEX_BIT, .module = VS, .pName = "main", .pSpecializationInfo = nullptr }));
+		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_VERTEX_BIT, .module = VS, .pName = "main", .pSpecializationInfo = SIs[0] }));
 	}
 	if (VK_NULL_HANDLE != FS) {
-		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_FRAGMENT_BIT, .module = FS, .pName = "main", .pSpecializationInfo = nullptr }));
+		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_FRAGMENT_BIT, .module = FS, .pName = "main", .pSpecializationInfo = SIs[1] }));
 	}
 	if (VK_NULL_HANDLE != TES) {
-		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, .module = TES, .pName = "main", .pSpecializationInfo = nullptr }));
+		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, .module = TES, .pName = "main", .pSpecializationInfo = SIs[2] }));
 	}
 	if (VK_NULL_HANDLE != TCS) {
-		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, .module = TCS, .pName = "main", .pSpecializationInfo = nullptr }));
+		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, .module = TCS, .pName = "main", .pSpecializationInfo = SIs[3] }));
 	}
 	if (VK_NULL_HANDLE != GS) {
-		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_GEOMETRY_BIT, .module = GS, .pName = "main", .pSpecializationInfo = nullptr }));
+		PSSCIs.emplace_back(VkPipelineShaderStageCreateInfo({ .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .pNext = nullptr, .flags = 0, .stage = VK_SHADER_STAGE_GEOMETRY_BIT, .module = GS, .pName = "main", .pSpecializationInfo = SIs[4] }));
 	}
 
 	const VkPipelineVertexInputStateCreateInfo PVISCI = {
@@ -1502,11 +2882,37 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.vertexAttributeDescriptionCount = static_cast<uint32_t>(std::size(VIADs)), .pVertexAttributeDescriptions = std::data(VIADs)
 	};
 
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+	//!< 記録時に設定するステートはパイプライン間で共通の値にして、同じパイプライン (ライブラリ、キャッシュ) になるようにする
+	//!< (States set at record time use common values, so pipelines (libraries, cache) can be shared)
+	//!< トポロジはクラス (ポイント、ライン、トライアングル、パッチ) が一致している必要がある (Topology class (point, line, triangle, patch) must match)
+	const auto Topology = [&]() {
+		switch (PT) {
+		case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+		case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+		case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+			return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		default:
+			return PT;
+		}
+	}();
+	const auto PolygonMode = HasDynamicPolygonMode ? VK_POLYGON_MODE_FILL : PM;
+	constexpr auto CullMode = VK_CULL_MODE_NONE;
+	constexpr auto FrontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	constexpr auto DepthTest = VK_FALSE;
+#else
+	const auto Topology = PT;
+	const auto PolygonMode = PM;
+	const auto CullMode = CMF;
+	const auto FrontFace = FF;
+	const auto DepthTest = DepthEnable;
+#endif
+
 	const VkPipelineInputAssemblyStateCreateInfo PIASCI = {
 		.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
 		.pNext = nullptr,
 		.flags = 0,
-		.topology = PT,
+		.topology = Topology,
 		.primitiveRestartEnable = VK_FALSE
 	};
 
@@ -1517,7 +2923,7 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.patchControlPoints = PatchControlPoints
 	};
 
-	//!< _Ci~bNXe[gɂ̂łł͌ߑł
+	//!< ダイナミックステートにするのでここでは決め打ち
 	constexpr VkPipelineViewportStateCreateInfo PVSCI = {
 		.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
 		.pNext = nullptr,
@@ -1532,9 +2938,9 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.flags = 0,
 		.depthClampEnable = VK_FALSE,
 		.rasterizerDiscardEnable = VK_FALSE,
-		.polygonMode = PM,
-		.cullMode = CMF,
-		.frontFace = FF,
+		.polygonMode = PolygonMode,
+		.cullMode = CullMode,
+		.frontFace = FrontFace,
 		.depthBiasEnable = VK_FALSE, .depthBiasConstantFactor = 0.0f, .depthBiasClamp = 0.0f, .depthBiasSlopeFactor = 0.0f,
 		.lineWidth = 1.0f
 	};
@@ -1554,7 +2960,7 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
 		.pNext = nullptr,
 		.flags = 0,
-		.depthTestEnable = DepthEnable, .depthWriteEnable = DepthEnable, .depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL,
+		.depthTestEnable = DepthTest, .depthWriteEnable = DepthTest, .depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL,
 		.depthBoundsTestEnable = VK_FALSE,
 		.stencilTestEnable = VK_FALSE,
 		.front = VkStencilOpState({
@@ -1591,7 +2997,17 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.blendConstants = { 1.0f, 1.0f, 1.0f, 1.0f }
 	};
 	
-	constexpr std::array DSs = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR, };
+	std::vector DSs = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR, };
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+	DSs.insert(std::end(DSs), {
+		VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY,
+		VK_DYNAMIC_STATE_CULL_MODE, VK_DYNAMIC_STATE_FRONT_FACE,
+		VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE, VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE, VK_DYNAMIC_STATE_DEPTH_COMPARE_OP,
+	});
+	if (HasDynamicPolygonMode) {
+		DSs.emplace_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+	}
+#endif
 	const VkPipelineDynamicStateCreateInfo PDSCI = {
 		.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
 		.pNext = nullptr,
@@ -1599,7 +3015,22 @@ void VK::CreatePipeline(VkPipeline& PL,
 		.dynamicStateCount = static_cast<uint32_t>(std::size(DSs)), .pDynamicStates = std::data(DSs)
 	};
 
-	CreatePipeline(PL, PSSCIs, PVISCI, PIASCI, PTSCI, PVSCI, PRSCI, PMSCI, PDSSCI, PCBSCI, PDSCI, PLL, RP);
+	CreatePipeline(PL, PSSCIs, PVISCI, PIASCI, PTSCI, PVSCI, PRSCI, PMSCI, PDSSCI, PCBSCI, PDSCI, PLL, RP, PRCI);
+}
+
+void VK::SetDynamicState([[maybe_unused]] const VkCommandBuffer CB, [[maybe_unused]] const DynamicState& DS)
+{
+#ifdef USE_EXTENDED_DYNAMIC_STATE
+	vkCmdSetPrimitiveTopology(CB, DS.Topology);
+	vkCmdSetCullMode(CB, DS.CullMode);
+	vkCmdSetFrontFace(CB, DS.FrontFace);
+	vkCmdSetDepthTestEnable(CB, DS.DepthEnable);
+	vkCmdSetDepthWriteEnable(CB, DS.DepthEnable);
+	vkCmdSetDepthCompareOp(CB, VK_COMPARE_OP_LESS_OR_EQUAL);
+	if (HasDynamicPolygonMode) {
+		vkCmdSetPolygonMode(CB, DS.PolygonMode);
+	}
+#endif
 }
 
 void VK::CreateFramebuffer(const VkRenderPass RP)
@@ -1619,10 +3050,141 @@ void VK::CreateFramebuffer(const VkRenderPass RP)
 	}
 }
 
+void VK::CreateBindlessDescriptor(const uint32_t BufferCapacity, const uint32_t ImageCapacity)
+{
+	if (!HasBindless) {
+		std::cerr << "Descriptor indexing is not supported" << std::endl;
+		BREAKPOINT();
+		return;
+	}
+
+	//!< 更新後バインドの上限でクランプ (Clamp by update after bind limits)
+	VkPhysicalDeviceVulkan12Properties PDV12P = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES, .pNext = nullptr };
+	VkPhysicalDeviceProperties2 PDP2 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &PDV12P };
+	vkGetPhysicalDeviceProperties2(SelectedPhysDevice.first, &PDP2);
+	Bindless.BufferCapacity = (std::min)(BufferCapacity, PDV12P.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+	Bindless.ImageCapacity = (std::min)(ImageCapacity, PDV12P.maxPerStageDescriptorUpdateAfterBindSampledImages);
+
+	//!< デスクリプタセットレイアウト (Descriptor set layout)
+	{
+		const std::array DSLBs = {
+			VkDescriptorSetLayoutBinding({.binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = Bindless.BufferCapacity, .stageFlags = VK_SHADER_STAGE_ALL, .pImmutableSamplers = nullptr }),
+			VkDescriptorSetLayoutBinding({.binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = Bindless.ImageCapacity, .stageFlags = VK_SHADER_STAGE_ALL, .pImmutableSamplers = nullptr }),
+		};
+		//!< 未登録の要素があってもよい (PARTIALLY_BOUND)、コマンドバッファ記録後にも更新できる (UPDATE_AFTER_BIND, UPDATE_UNUSED_WHILE_PENDING)
+		//!< (Unregistered elements are allowed, can be updated after command buffer is recorded)
+		constexpr VkDescriptorBindingFlags DBF = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+		constexpr std::array DBFs = { DBF, DBF | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT };
+		const VkDescriptorSetLayoutBindingFlagsCreateInfo DSLBFCI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+			.pNext = nullptr,
+			.bindingCount = static_cast<uint32_t>(std::size(DBFs)), .pBindingFlags = std::data(DBFs)
+		};
+		const VkDescriptorSetLayoutCreateInfo DSLCI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+			.pNext = &DSLBFCI,
+			.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+			.bindingCount = static_cast<uint32_t>(std::size(DSLBs)), .pBindings = std::data(DSLBs)
+		};
+		VERIFY_SUCCEEDED(vkCreateDescriptorSetLayout(Device, &DSLCI, nullptr, &Bindless.DescriptorSetLayout));
+	}
+
+	//!< デスクリプタプール (Descriptor pool)
+	{
+		const std::array DPSs = {
+			VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = Bindless.BufferCapacity }),
+			VkDescriptorPoolSize({.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = Bindless.ImageCapacity }),
+		};
+		const VkDescriptorPoolCreateInfo DPCI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+			.pNext = nullptr,
+			.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+			.maxSets = 1,
+			.poolSizeCount = static_cast<uint32_t>(std::size(DPSs)), .pPoolSizes = std::data(DPSs)
+		};
+		VERIFY_SUCCEEDED(vkCreateDescriptorPool(Device, &DPCI, nullptr, &Bindless.DescriptorPool));
+	}
+
+	//!< デスクリプタセット (Descriptor set)
+	{
+		const std::array DCs = { Bindless.ImageCapacity };
+		const VkDescriptorSetVariableDescriptorCountAllocateInfo DSVDCAI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO,
+			.pNext = nullptr,
+			.descriptorSetCount = static_cast<uint32_t>(std::size(DCs)), .pDescriptorCounts = std::data(DCs)
+		};
+		const VkDescriptorSetAllocateInfo DSAI = {
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			.pNext = &DSVDCAI,
+			.descriptorPool = Bindless.DescriptorPool,
+			.descriptorSetCount = 1, .pSetLayouts = &Bindless.DescriptorSetLayout
+		};
+		VERIFY_SUCCEEDED(vkAllocateDescriptorSets(Device, &DSAI, &Bindless.DescriptorSet));
+	}
+
+	LOG();
+}
+VK::BindlessHandle VK::RegisterBindlessBuffer(const VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range)
+{
+	//!< 容量を超えた場合は範囲外へ書き込まず、無効なハンドルを返す (When capacity is exceeded, return invalid handle instead of writing out of range)
+	if (Bindless.BufferCount >= Bindless.BufferCapacity) {
+		std::cerr << "Bindless buffer capacity exceeded (" << Bindless.BufferCapacity << ")" << std::endl;
+		BREAKPOINT();
+		return InvalidBindlessHandle;
+	}
+	const auto Handle = Bindless.BufferCount++;
+	UpdateBindlessBuffer(Handle, Buffer, Offset, Range);
+	return Handle;
+}
+VK::BindlessHandle VK::RegisterBindlessImage(const VkImageView IV, const VkSampler Sampler, const VkImageLayout IL)
+{
+	//!< 容量を超えた場合は範囲外へ書き込まず、無効なハンドルを返す (When capacity is exceeded, return invalid handle instead of writing out of range)
+	if (Bindless.ImageCount >= Bindless.ImageCapacity) {
+		std::cerr << "Bindless image capacity exceeded (" << Bindless.ImageCapacity << ")" << std::endl;
+		BREAKPOINT();
+		return InvalidBindlessHandle;
+	}
+	const auto Handle = Bindless.ImageCount++;
+	UpdateBindlessImage(Handle, IV, Sampler, IL);
+	return Handle;
+}
+void VK::UpdateBindlessBuffer(const BindlessHandle Handle, const VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range)
+{
+	if (Handle >= Bindless.BufferCount) { BREAKPOINT(); return; }
+	const std::array DBIs = { VkDescriptorBufferInfo({.buffer = Buffer, .offset = Offset, .range = Range }) };
+	const std::array WDSs = {
+		VkWriteDescriptorSet({
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.pNext = nullptr,
+			.dstSet = Bindless.DescriptorSet,
+			.dstBinding = 0, .dstArrayElement = Handle,
+			.descriptorCount = static_cast<uint32_t>(std::size(DBIs)), .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.pImageInfo = nullptr, .pBufferInfo = std::data(DBIs), .pTexelBufferView = nullptr
+		}),
+	};
+	vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
+}
+void VK::UpdateBindlessImage(const BindlessHandle Handle, const VkImageView IV, const VkSampler Sampler, const VkImageLayout IL)
+{
+	if (Handle >= Bindless.ImageCount) { BREAKPOINT(); return; }
+	const std::array DIIs = { VkDescriptorImageInfo({.sampler = Sampler, .imageView = IV, .imageLayout = IL }) };
+	const std::array WDSs = {
+		VkWriteDescriptorSet({
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.pNext = nullptr,
+			.dstSet = Bindless.DescriptorSet,
+			.dstBinding = 1, .dstArrayElement = Handle,
+			.descriptorCount = static_cast<uint32_t>(std::size(DIIs)), .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+			.pImageInfo = std::data(DIIs), .pBufferInfo = nullptr, .pTexelBufferView = nullptr
+		}),
+	};
+	vkUpdateDescriptorSets(Device, static_cast<uint32_t>(std::size(WDSs)), std::data(WDSs), 0, nullptr);
+}
+
 void VK::PopulateSecondaryCommandBuffer([[maybe_unused]] const int i) 
 {
 #if false
-	//!< ZJ_gꍇ̃TvR[h (Sample code using secondary command buffer)
+	//!< セカンダリを使う場合のサンプルコード (Sample code using secondary command buffer)
 	const auto RP = RenderPasses[0];
 	const auto CB = SecondaryCommandBuffers[0].second[i];
 
@@ -1693,7 +3255,7 @@ void VK::PopulatePrimaryCommandBuffer(const int i)
 			.clearValueCount = static_cast<uint32_t>(size(CVs)), .pClearValues = data(CVs)
 		};
 #if true
-		//!< ZJ_gȂTvR[h (Sample code without secondary command buffer)
+		//!< セカンダリを使わないサンプルコード (Sample code without secondary command buffer)
 		vkCmdBeginRenderPass(CB, &RPBI, VK_SUBPASS_CONTENTS_INLINE); {			
 			//vkCmdBindPipeline(CB, VK_PIPELINE_BIND_POINT_GRAPHICS, Pipelines[0]);
 
@@ -1701,7 +3263,7 @@ void VK::PopulatePrimaryCommandBuffer(const int i)
 			vkCmdSetScissor(CB, 0, static_cast<uint32_t>(std::size(ScissorRects)), std::data(ScissorRects));
 		} vkCmdEndRenderPass(CB);
 #else
-		//!< ZJ_gTvR[h (Sample code with secondary command buffer)
+		//!< セカンダリを使うサンプルコード (Sample code with secondary command buffer)
 		vkCmdBeginRenderPass(CB, &RPBI, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS); {
 			const auto SCB = SecondaryCommandBuffers[0].second[i];
 			const std::array SCBs = { SCB };
@@ -1733,6 +3295,7 @@ void VK::SubmitAndWait(const VkCommandBuffer CB)
 			.signalSemaphoreInfoCount = static_cast<uint32_t>(std::size(SignalSSIs)), .pSignalSemaphoreInfos = std::data(SignalSSIs)
 		})
 	};
+	std::lock_guard Lock(QueueMutex);
 	VERIFY_SUCCEEDED(vkQueueSubmit2(GraphicsQueue.first, static_cast<uint32_t>(std::size(SIs)), std::data(SIs), VK_NULL_HANDLE));
 	VERIFY_SUCCEEDED(vkQueueWaitIdle(GraphicsQueue.first));
 }
\ No newline at end of file
@@ -2,16 +2,22 @@
 
 #include <iostream>
 #include <vector>
+#include <map>
+#include <set>
+#include <memory>
 #include <utility>
+#include <functional>
 #include <numeric>
 #include <filesystem>
 #include <numbers>
 #include <span>
 #include <thread>
+#include <chrono>
 #include <mutex>
 #include <source_location>
 #include <random>
 #include <cstddef>
+#include <type_traits>
 
 #include <vulkan/vulkan.h>
 
@@ -19,6 +25,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "GLI.h"
+class TextureFile;
 
 #ifdef _WIN64
 #pragma comment(lib, "vulkan-1.lib")
@@ -30,8 +37,20 @@
 //#ifndef USE_HALIO
 //#define USE_HAILO
 //#endif
+//!< カリング、トポロジ、デプス、ポリゴンモードを記録時に設定する (Set culling, topology, depth, polygon mode at record time)
+//#ifndef USE_EXTENDED_DYNAMIC_STATE
+//#define USE_EXTENDED_DYNAMIC_STATE
+//#endif
+//!< レンダーパス、フレームバッファを使わずに vkCmdBeginRendering() で描画する (Render with vkCmdBeginRendering() without render pass, framebuffer)
+//#ifndef USE_DYNAMIC_RENDERING
+//#define USE_DYNAMIC_RENDERING
+//#endif
+//!< シェーダのソースを監視し、変更されたらパイプラインを作り直す (Watch shader sources, recreate pipelines when changed)
+//#ifndef USE_SHADER_HOT_RELOAD
+//#define USE_SHADER_HOT_RELOAD
+//#endif
 
-//!< gpɂ USE_CV `Kv
+//!< 使用には USE_CV を定義する必要がある
 #ifdef USE_CV
 #include "CV.h"
 #ifdef _WIN64
@@ -43,7 +62,7 @@
 #endif
 #endif
 
-//!< gpɂ USE_HAILO `Kv
+//!< 使用には USE_HAILO を定義する必要がある
 #ifdef USE_HAILO
 #include "Hailo.h"
 #ifdef _WIN64
@@ -51,6 +70,18 @@
 #endif
 #endif
 
+//!< 使用には USE_SHADER_HOT_RELOAD を定義する必要がある
+#ifdef USE_SHADER_HOT_RELOAD
+#include "ShaderWatcher.h"
+#ifdef _WIN64
+#ifdef _DEBUG
+#pragma comment(lib, "shaderc_combinedd.lib")
+#else
+#pragma comment(lib, "shaderc_combined.lib")
+#endif
+#endif
+#endif
+
 //!< std::breakpoint() c++26
 #ifdef _WIN64
 #ifdef _DEBUG
@@ -86,6 +117,20 @@
 template<typename T> static constexpr size_t TotalSizeOf(const std::vector<T>& rhs) { return sizeof(T) * size(rhs); }
 template<typename T, size_t U> static constexpr size_t TotalSizeOf(const std::array<T, U>& rhs) { return sizeof(rhs); }
 
+//!< FNV-1a ハッシュ (FNV-1a hash)
+static constexpr size_t HashBytes(size_t Seed, std::span<const std::byte> Data) {
+	for (const auto i : Data) {
+		Seed = (Seed ^ static_cast<size_t>(i)) * static_cast<size_t>(1099511628211ull);
+	}
+	return Seed;
+}
+template<typename T> requires std::is_trivially_copyable_v<T> static size_t HashCombine(const size_t Seed, const T& rhs) { return HashBytes(Seed, std::as_bytes(std::span<const T>(&rhs, 1))); }
+static constexpr size_t HashSeed = static_cast<size_t>(14695981039346656037ull);
+
+#include "FrameGraph.h"
+#include "DescriptorAllocator.h"
+#include "JobSystem.h"
+
 class VK
 {
 public:
@@ -103,6 +148,8 @@ public:
 		ImageAndView ImageView;
 		VkDeviceMemory DeviceMemory;
 		std::vector<BufferAndDeviceMemory> Staging;
+		//!< イメージを共有するテクスチャ間の参照カウント、最後の参照が破棄された時にイメージを破棄する (Reference count among textures sharing image, image is destroyed when last reference is destroyed)
+		std::shared_ptr<const ImageAndView> SharedImage;
 	};
 	using CommandPoolAndBuffers = std::pair<VkCommandPool, std::vector<VkCommandBuffer>>;
 	using PathAndPipelineStage = std::pair<std::filesystem::path, VkPipelineStageFlags2>;
@@ -112,37 +159,72 @@ public:
 		cv::Mat Mat;
 		VkFormat Format;
 		VkPipelineStageFlags2 PipelineStage;
+		//!< ミップチェインを GPU で作成する (Generate mip chain on GPU)
+		bool Mipmap = false;
+		//!< 0 以外の場合、同じキーのテクスチャが既にあればイメージを共有する (If not 0, share image if texture with same key already exists)
+		size_t Key = 0;
 	};
 #endif
 
 	virtual ~VK();
+	//!< ループを抜けた後、派生クラスが破棄される前に呼ぶ (exit() ではデストラクタが呼ばれない為)、GPU の完了を待ち、パイプラインキャッシュを保存する
+	//!< (Call after loop, before derived classes are destroyed (destructor is not called with exit()), wait for GPU and save pipeline cache)
+	void Shutdown();
 
 	static constexpr size_t RoundUpMask(const size_t Size, const size_t Mask) { return (Size + Mask) & ~Mask; }
 	static constexpr size_t RoundUp(const size_t Size, const size_t Align) { return RoundUpMask(Size, Align - 1); }
 	static constexpr size_t RoundUp256(const size_t Size) { return RoundUpMask(Size, 0xff); }
 
 	virtual void Init() {
-		CreateInstance();
-		SelectPhysicalDevice();
-		CreateSurface();
-		SelectSurfaceFormat();
-		CreateDevice();
-		CreateFenceAndSemaphore();
-		CreateSwapchain();
-		CreateCommandBuffer();
-		CreateGeometry();
-		CreateUniformBuffer();
-		CreateTexture();
-		CreatePipelineLayout();
-		CreateRenderPass();
-		CreatePipeline();
-		CreateFramebuffer();
-		CreateDescriptor();
-		CreateViewports();
+		InitBegin = std::chrono::steady_clock::now();
+
+		//!< デバイス、スワップチェイン、コマンドバッファ迄はそれぞれ前のステージに依存するので、このスレッドで順に実行する
+		//!< (Up to device, swapchain, command buffer each stage depends on previous one, so run in order on this thread)
+		RunInitStage("CreateInstance", [this] { CreateInstance(); });
+		RunInitStage("SelectPhysicalDevice", [this] { SelectPhysicalDevice(); });
+		RunInitStage("CreateSurface", [this] { CreateSurface(); });
+		RunInitStage("SelectSurfaceFormat", [this] { SelectSurfaceFormat(); });
+		RunInitStage("CreateDevice", [this] { CreateDevice(); });
+		RunInitStage("CreateFenceAndSemaphore", [this] { CreateFenceAndSemaphore(); });
+		RunInitStage("CreateSwapchain", [this] { CreateSwapchain(); });
+		RunInitStage("CreateCommandBuffer", [this] { CreateCommandBuffer(); CreateTransferCommandBuffer(); });
+
+		//!< 以降は依存関係のグラフとしてジョブで並列に実行する (Rest is run in parallel as jobs of dependency graph)
+		//!< ジオメトリとテクスチャはアップロードに同じコマンドバッファを使うので直列にする (Geometry and texture use the same command buffer for upload, so serialize them)
+		const auto Geometry = ScheduleInitStage("CreateGeometry", [this] { CreateGeometry(); });
+		const auto UniformBuffer = ScheduleInitStage("CreateUniformBuffer", [this] { CreateUniformBuffer(); });
+		const auto Texture = ScheduleInitStage("CreateTexture", [this] { CreateTexture(); }, { Geometry });
+		const auto PipelineLayout = ScheduleInitStage("CreatePipelineLayout", [this] { CreatePipelineLayout(); });
+		const auto RenderPass = ScheduleInitStage("CreateRenderPass", [this] { CreateRenderPass(); });
+		//!< パイプラインの作成 (シェーダの読み込み、コンパイル) はテクスチャの読み込みと並行する (Pipeline creation (shader load, compile) runs concurrently with texture load)
+		const auto Pipeline = ScheduleInitStage("CreatePipeline", [this] { CreatePipeline(); }, { PipelineLayout, RenderPass });
+		const auto Framebuffer = ScheduleInitStage("CreateFramebuffer", [this] { CreateFramebuffer(); }, { RenderPass, Texture });
+		const auto Descriptor = ScheduleInitStage("CreateDescriptor", [this] { CreateDescriptor(); }, { PipelineLayout, UniformBuffer, Texture });
+		const auto Viewports = ScheduleInitStage("CreateViewports", [this] { CreateViewports(); });
+		const std::array Stages = { Geometry, UniformBuffer, Texture, PipelineLayout, RenderPass, Pipeline, Framebuffer, Descriptor, Viewports };
+		JobSystem::Get().Wait(Stages);
+
+		LogInitStages();
+#ifdef USE_SHADER_HOT_RELOAD
+		ShaderWatch = std::make_unique<ShaderWatcher>(GetShaderDirectory());
+#endif
 	}
 	virtual void Render() {
 		if (ReCreateSwapchain()) {
 			WaitFence();
+			//!< 作り直したパイプライン、最適化リンクが完了したパイプライン、アップロードが完了したテクスチャがあれば差し替えて、コマンド発行をやり直す
+			//!< (If recreated or optimized pipelines, or uploaded textures are ready, swap them and repopulate commands)
+			const auto IsRecreated = SwapRecreatedPipelines();
+			const auto IsUploaded = SwapUploadedTextures();
+			if (SwapOptimizedPipelines() || IsRecreated || IsUploaded) {
+				PopulateCommandBuffer();
+			}
+#ifdef USE_SHADER_HOT_RELOAD
+			//!< 作り直し中のシェーダの変更は次回に持ち越す (Shader changes during recreation are carried over to next time)
+			if (nullptr != ShaderWatch && !IsRecreatingPipeline() && ShaderWatch->ConsumeChanged()) {
+				RecreatePipeline();
+			}
+#endif
 			if (AcquireNextImage()) {
 				OnUpdate();
 				Submit();
@@ -168,13 +250,24 @@ public:
 	virtual void CreateTexture() { LOG(); }
 	virtual void CreatePipelineLayout();
 	virtual void CreateRenderPass() { 
+#ifndef USE_DYNAMIC_RENDERING
 		CreateRenderPass_Clear(); 	
+#endif
+		LOG();
+	}
+	virtual void CreatePipeline() { 
+		CreatePipeline(Pipelines);
 		LOG();
 	}
-	virtual void CreatePipeline() { LOG(); }
+	//!< 作成先を指定する、作り直す場合は差し替え用の配列に作成する (Destination is specified, created into array for swap when recreating)
+	virtual void CreatePipeline([[maybe_unused]] std::vector<VkPipeline>& PLs) {}
+	//!< シェーダ (ソース、.spv) の場所 (Location of shaders (source, .spv))
+	virtual std::filesystem::path GetShaderDirectory() const { return std::filesystem::path("."); }
 	virtual void CreateFramebuffer() {
+#ifndef USE_DYNAMIC_RENDERING
 		Framebuffers.reserve(std::size(Swapchain.ImageAndViews));
 		CreateFramebuffer(RenderPasses[0]);
+#endif
 		LOG();
 	}
 	virtual void CreateDescriptor() { LOG(); }
@@ -192,6 +285,9 @@ public:
 	virtual void WaitFence();
 	virtual bool AcquireNextImage();
 	virtual void OnUpdate() { if (0 == FrameCount) { LOG(); } }
+	//!< フレーム毎に記録する転送 (ページのストリーミング等)、記録した場合は true を返すと、フレームのコマンドより先にサブミットされる
+	//!< (Per frame transfer (page streaming etc.), return true if recorded, then submitted before commands of frame)
+	virtual bool PopulateTransferCommandBuffer([[maybe_unused]] const VkCommandBuffer CB) { return false; }
 	virtual void Submit();
 	virtual bool Present();
 
@@ -200,6 +296,10 @@ public:
 	bool CreateSwapchain(const uint32_t Width, const uint32_t Height);
 
 	void CopyToHostVisibleMemory(const VkDeviceMemory DeviceMemory, const VkDeviceSize Offset, const VkDeviceSize Size, const void* Source, const VkDeviceSize MappedRangeOffset = 0, const VkDeviceSize MappedRangeSize = VK_WHOLE_SIZE) const;
+#ifdef USE_CV
+	//!< 連続していない (ROI) 場合は行毎にコピーする (Copied per row if not continuous (ROI))
+	void CopyToHostVisibleMemory(const VkDeviceMemory DeviceMemory, const VkDeviceSize Offset, const cv::Mat& CvMat) const;
+#endif
 
 	uint32_t GetMemoryTypeIndex(const uint32_t TypeBits, const VkMemoryPropertyFlags MPF) const;
 	void CreateBuffer(VkBuffer* Buffer, VkDeviceMemory* DeviceMemory, const VkBufferUsageFlags BUF, const VkMemoryPropertyFlags MPF, const size_t Size, const void* Source = nullptr) const;
@@ -216,8 +316,17 @@ public:
 	}
 	void CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const size_t Size, const void* Source) const { CreateHostVisibleBuffer(&BADM.first, &BADM.second, BUF, Size, Source); }
 	void CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const gli::texture& Gli) const { CreateHostVisibleBuffer(&BADM.first, &BADM.second, BUF, Gli.size(), Gli.data()); }
+	//!< マップされたファイルから各領域をステージングへ直接コピーし、BICs へ追加する (Copy each region from mapped file directly into staging, append to BICs)
+	void CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const TextureFile& TF, std::vector<VkBufferImageCopy2>& BICs) const;
 #ifdef USE_CV
-	void CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const cv::Mat& CvMat) const { CreateHostVisibleBuffer(&BADM.first, &BADM.second, BUF, CvMat.total() * CvMat.elemSize(), reinterpret_cast<const void*>(CvMat.ptr())); }
+	//!< cv::Mat はステージング上でも行のピッチ (step) を保つので、ROI でもクローンせずにそのまま転送できる (bufferRowLength で指定する)
+	//!< (cv::Mat keeps its row pitch (step) on staging, so ROI can be uploaded as is without clone (specified with bufferRowLength))
+	static size_t GetStagingPitch(const cv::Mat& CvMat) { return 0 == CvMat.step[0] % CvMat.elemSize() ? CvMat.step[0] : CvMat.cols * CvMat.elemSize(); }
+	static size_t GetStagingSize(const cv::Mat& CvMat) { return CvMat.empty() ? 0 : GetStagingPitch(CvMat) * (CvMat.rows - 1) + CvMat.cols * CvMat.elemSize(); }
+	void CreateHostVisibleBuffer(BufferAndDeviceMemory& BADM, const VkBufferUsageFlags BUF, const cv::Mat& CvMat) const {
+		CreateHostVisibleBuffer(BADM, BUF, GetStagingSize(CvMat), nullptr);
+		CopyToHostVisibleMemory(BADM.second, 0, CvMat);
+	}
 #endif
 
 	void CreateImage(VkImage* Image, VkDeviceMemory* DeviceMemory, const VkImageCreateInfo& ICI);
@@ -266,6 +375,7 @@ public:
 	void PopulateCopyCommand(const VkCommandBuffer CB,
 		const VkBuffer Staging, const VkImage Image, const std::span<const VkBufferImageCopy2>& BICs, const VkImageSubresourceRange& ISR, 
 		const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF) const;
+	static void GetBufferImageCopies(const gli::texture& Gli, std::vector<VkBufferImageCopy2>& BICs);
 	void PopulateCopyCommand(const VkCommandBuffer CB, 
 		const VkBuffer Staging, const VkImage Image, const gli::texture& Gli, 
 		const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF) const;
@@ -288,15 +398,22 @@ public:
 			IL, AF, PSF);
 	}
 #endif
+	//!< レベル 0 から vkCmdBlitImage2 で半分ずつ縮小してミップチェインを作成する、全レベルが TRANSFER_DST_OPTIMAL であること
+	//!< (Generate mip chain by halving from level 0 with vkCmdBlitImage2, all levels must be in TRANSFER_DST_OPTIMAL)
+	void PopulateMipmapCommand(const VkCommandBuffer CB,
+		const VkImage Image, const uint32_t Width, const uint32_t Height, const uint32_t MipLevels,
+		const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlags2 PSF) const;
+	//!< RowLength はステージング上の行のテクセル数 (0 なら Width) (RowLength is texels per row on staging (Width if 0))
 	void PopulateCopyCommand(const VkCommandBuffer CB,
 		const VkBuffer Staging, const VkImage Image, const uint32_t Width, const uint32_t Height,
-		const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF) const
+		const VkImageLayout IL, const VkAccessFlags2 AF, const VkPipelineStageFlagBits2 PSF,
+		const VkDeviceSize Offset = 0, const uint32_t RowLength = 0) const
 	{
 		const std::array BICs = {
 			VkBufferImageCopy2({
 				.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2,
 				.pNext = nullptr,
-				.bufferOffset = 0, .bufferRowLength = 0, .bufferImageHeight = 0,
+				.bufferOffset = Offset, .bufferRowLength = RowLength, .bufferImageHeight = 0,
 				.imageSubresource = VkImageSubresourceLayers({.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .mipLevel = 0, .baseArrayLayer = 0, .layerCount = 1 }),
 				.imageOffset = VkOffset3D({.x = 0, .y = 0, .z = 0 }),
 				.imageExtent = VkExtent3D({.width = Width, .height = Height, .depth = 1 }) }),
@@ -324,6 +441,8 @@ public:
 		CPAB.second.resize(Count);
 		AllocateCommandBuffers(std::size(CPAB.second), std::data(CPAB.second), CPAB.first, CBL);
 	}
+	//!< 1 フレームのみ処理中なので 1 つで良い (Only one frame in flight, so one is enough)
+	void CreateTransferCommandBuffer() { AllocateCommandBuffers(CreateCommandPool(TransferCommandBuffers), 1, VK_COMMAND_BUFFER_LEVEL_PRIMARY); }
 
 	struct GeometryCreateInfo {
 		std::vector<SizeAndDataPtr> Vtxs = {};
@@ -396,13 +515,103 @@ public:
 	[[nodiscard]] static VkImageViewType ToVkImageViewType(const gli::target GLITarget);
 	[[nodiscard]] static VkComponentSwizzle ToVkComponentSwizzle(const gli::swizzle GLISwizzle);
 	[[nodiscard]] static VkComponentMapping ToVkComponentMapping(const gli::texture::swizzles_type GLISwizzleType);
+	//!< ルミナンス、アルファ等 VkFormat に無いものはスウィズルで表現する (Express luminance, alpha etc. which VkFormat does not have by swizzle)
+	[[nodiscard]] static VkComponentMapping ToVkComponentMapping(const gli::format GLIFormat, const gli::texture::swizzles_type GLISwizzleType);
+	//!< 最適タイリングで FFF をサポートするか (Whether FFF is supported with optimal tiling)
+	[[nodiscard]] bool IsSupportedFormat(const VkFormat Format, const VkFormatFeatureFlags FFF) const;
+	//!< デバイスがサポートしないフォーマットは CPU で RGBA8 へ変換する、2D 以外や展開できない圧縮フォーマットの場合は false を返す
+	//!< (Convert to RGBA8 on CPU if device does not support the format, returns false for non 2D or compressed format which cannot be decoded)
+	[[nodiscard]] bool ConvertToSupportedFormat(gli::texture& Gli) const;
+	//!< 変換できないテクスチャの代わりに使う 1x1 のマゼンタ (1x1 magenta used instead of texture which cannot be converted)
+	[[nodiscard]] static gli::texture GetFallbackGLI();
 	Texture& CreateGLITexture(const std::filesystem::path& Path, gli::texture& Gli);
+	//!< Textures へは追加しない、MipLevels が 0 の場合は Gli のレベル数 (Not added to Textures, if MipLevels is 0, level count of Gli)
+	void CreateGLITexture(Texture& Tex, const gli::texture& Gli, const uint32_t MipLevels = 0);
+	void CreateGLITexture(Texture& Tex, const TextureFile& TF, const uint32_t MipLevels = 0);
+	void CreateGLITexture(Texture& Tex, const gli::target Target, const gli::format Format, const gli::extent3d& Extent, const uint32_t Layers, const uint32_t FileLevels, const uint32_t MipLevels, const VkComponentMapping& CM);
+	//!< DDS, KTX はマップしてステージングへ直接コピーする、できない場合は gli::load() する、作成したレベル数を返す
+	//!< (Map DDS, KTX and copy directly into staging, gli::load() if not possible, returns created level count)
+	uint32_t CreateGLITexture(Texture& Tex, BufferAndDeviceMemory& Staging, std::vector<VkBufferImageCopy2>& BICs, const std::filesystem::path& Path, const bool Mipmap = false);
 	void CreateGLITextures(const VkCommandBuffer CB, const std::vector<PathAndPipelineStage>& Paths);
 #ifdef USE_CV
-	Texture& CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format);
+	Texture& CreateCVTexture(const cv::Mat& CvMat, const VkFormat Format, const uint32_t MipLevels = 1);
+	void CreateCVTexture(Texture& Tex, const cv::Mat& CvMat, const VkFormat Format, const uint32_t MipLevels = 1);
 	void CreateCVTextures(const VkCommandBuffer CB, const std::vector<CvMatAndFormatAndPipelineStage>& CvMats);
 #endif
+	//!< 単色 1x1 のテクスチャ、非同期読み込みが完了するまでのプレースホルダ用 (Single color 1x1 texture, for placeholder until async load completes)
+	Texture& CreatePlaceholderTexture(const VkCommandBuffer CB, const VkClearColorValue& Color, const VkPipelineStageFlags2 PSF);
+	//!< ワーカースレッドで読み込み、アップロードし、GPU への転送が完了したらフレームの区切りで Textures[Index] (プレースホルダ) と差し替える
+	//!< (Load and upload on worker thread, replace Textures[Index] (placeholder) at frame boundary when transfer to GPU has completed)
+	//!< Mipmap の場合、ファイルにミップが無ければ GPU で作成する (In case Mipmap, generate on GPU if file has no mips)
+	JobSystem::JobHandle CreateGLITextureAsync(const size_t Index, const std::filesystem::path& Path, const VkPipelineStageFlags2 PSF, const bool Mipmap = false);
+#ifdef USE_CV
+	//!< デコードもワーカースレッドで行う (Decode is also done on worker thread)
+	//!< Key が 0 以外で同じキーのテクスチャがあれば (アップロード中ならその完了時に) イメージを共有し、ジョブは作成しない (nullptr を返す)
+	//!< (If Key is not 0 and texture with same key exists, share image (on its completion if uploading) and no job is created (returns nullptr))
+	JobSystem::JobHandle CreateCVTextureAsync(const size_t Index, std::function<cv::Mat()>&& Decode, const VkFormat Format, const VkPipelineStageFlags2 PSF, const bool Mipmap = false, const size_t Key = 0);
+#endif
+	//!< フルミップチェインのレベル数、フォーマットがリニアフィルタのブリットをサポートしない場合は 1 (Level count of full mip chain, 1 if format does not support linear filtered blit)
+	uint32_t GetMipLevels(const VkFormat Format, const uint32_t Width, const uint32_t Height) const;
+	//!< 読み込み中、もしくは差し替え待ちのテクスチャがあるか (Any texture being loaded or waiting for swap)
+	bool IsUploadingTexture();
+	//!< 共有されている場合は参照を外し、最後の参照のみがイメージを破棄する (If shared, release reference, only last reference destroys image)
+	void DestroyTexture(Texture& Tex) const;
+	//!< Textures[Dst] を破棄し、Textures[Src] のイメージを共有する、GPU から参照されていない時に呼ぶこと
+	//!< (Destroy Textures[Dst] and share image of Textures[Src], call when not referenced by GPU)
+	void ShareTexture(const size_t Dst, const size_t Src);
+	//!< Textures[Index] の内容が変わるので、Index を指す古いキーを外して Key を登録する (Content of Textures[Index] changes, so remove stale keys pointing to Index and register Key)
+	void SetTextureKey(const size_t Index, const size_t Key);
 	VkShaderModule CreateShaderModule(const std::filesystem::path& Path);
+	VkShaderModule CreateShaderModule(std::span<const uint32_t> Code);
+	//!< バイナリに埋め込まれた SPIR-V を使用する、埋め込まれていない場合はファイルを読み込む
+	//!< USE_SHADER_HOT_RELOAD 定義時のみ、ファイルが存在すればそちらで差し替える (古い .spv が埋め込みより優先されないように)
+	//!< (Use SPIR-V embedded in binary, load file if not embedded. Only when USE_SHADER_HOT_RELOAD is defined, overridden by file if exists (so that stale .spv does not take precedence over embedded))
+	VkShaderModule CreateShaderModule(const std::filesystem::path& Path, std::span<const uint32_t> Embedded) {
+#ifdef USE_SHADER_HOT_RELOAD
+		if (std::filesystem::exists(Path)) {
+			return CreateShaderModule(Path);
+		}
+#endif
+		if (!std::empty(Embedded)) {
+			return CreateShaderModule(Embedded);
+		}
+		return CreateShaderModule(Path);
+	}
+
+	//!< パイプラインキャッシュ、デバイスやドライバが変わった場合は読み込んだデータを破棄する (Pipeline cache, loaded data is discarded if device or driver has changed)
+	//!< 作業ディレクトリではなく実行ファイルの場所に置く (Placed next to executable, not in working directory)
+	virtual std::filesystem::path GetPipelineCachePath() const { return GetExecutableDirectory() / "PipelineCache.bin"; }
+	[[nodiscard]] static std::filesystem::path GetExecutableDirectory();
+	void CreatePipelineCache();
+	void SavePipelineCache();
+	//!< テクスチャキャッシュ、変換済み (GPU へそのまま送れる) データをソースの内容とロードパラメータをキーにして保存する
+	//!< (Texture cache, converted (GPU ready) data is stored keyed by source contents and load parameters)
+	virtual std::filesystem::path GetTextureCacheDirectory() const { return GetExecutableDirectory() / "TextureCache"; }
+	[[nodiscard]] static size_t HashFile(const std::filesystem::path& Path);
+	//!< Variant は同じソースから複数のテクスチャを作る場合に区別する (Variant distinguishes multiple textures made from same source)
+	[[nodiscard]] static size_t GetTextureCacheKey(const size_t ContentHash, const VkFormat Format, const VkComponentMapping& CM, const bool Mipmap, const uint32_t Variant = 0);
+#ifdef USE_CV
+	//!< キャッシュにあればデコード、変換をせずに読み込む、無ければ Decode() した結果をキャッシュへ書き出す
+	//!< (Load from cache without decode and conversion if exists, otherwise write result of Decode() to cache)
+	cv::Mat LoadCVTextureCache(const size_t Key, const std::function<cv::Mat()>& Decode) const;
+#endif
+	static void LogPipelineCreationFeedback(const VkPipelineCreationFeedback& PCF, std::span<const VkPipelineCreationFeedback> StagePCFs);
+
+	//!< グラフィックスパイプラインライブラリ、パーツ毎にライブラリとして作成 (キャッシュ) しリンクする (Graphics pipeline library, create (and cache) each part as library, then link)
+	VkPipeline CreatePipelineLibrary(const VkGraphicsPipelineLibraryFlagsEXT GPLF, const size_t Key, VkGraphicsPipelineCreateInfo GPCI);
+	VkPipeline LinkPipeline(std::span<const VkPipeline> Libraries, const VkPipelineLayout PLL, const VkRenderPass RP, const bool Optimize);
+	//!< レイアウト、レンダーパスはハンドルでキーにしているので、破棄する前に呼んでそれらを含むライブラリを破棄する (ハンドルが再利用された際に古いライブラリが返らないように)
+	//!< (Layout, render pass are keyed by handle, so call before destroying them to destroy libraries containing them (so that stale library is not returned when handle is reused))
+	void EvictPipelineLibraries(const VkPipelineLayout PLL, const VkRenderPass RP);
+	//!< バックグラウンドで最適化リンクが完了したパイプラインに差し替える、GPU が使用していない時に呼ぶこと (Replace with pipelines optimized in background, call while GPU is not using them)
+	bool SwapOptimizedPipelines();
+	//!< バックグラウンドでパイプラインを作り直し、完了したら SwapRecreatedPipelines() で差し替える (Recreate pipelines in background, swapped by SwapRecreatedPipelines() when done)
+	void RecreatePipeline();
+	bool IsRecreatingPipeline() const { return nullptr != PipelineRecreateJob && !PipelineRecreateJob->IsDone(); }
+	virtual bool SwapRecreatedPipelines();
+	//!< GPU から参照されなくなったパイプラインを破棄する、最適化リンク中の場合はリンク完了時に破棄する (Destroy pipeline no longer referenced by GPU, if optimized linking, destroyed when link completes)
+	void RetirePipeline(const VkPipeline PL);
+	size_t GetShaderModuleHash(const VkShaderModule SM);
 
 	void CreateRenderPass(const VkRenderPassCreateInfo& RPCI) { VERIFY_SUCCEEDED(vkCreateRenderPass(Device, &RPCI, nullptr, &RenderPasses.emplace_back())); }
 	void CreateRenderPass(const std::vector<VkAttachmentDescription>& ADs, const std::vector<VkSubpassDescription>& SDs) {
@@ -439,8 +648,46 @@ public:
 		const VkPipelineColorBlendStateCreateInfo& PCBSCI,
 		const VkPipelineDynamicStateCreateInfo& PDSCI,
 		const VkPipelineLayout PLL,
-		const VkRenderPass RP);
-	//!< 悭ĝɍi (Frequently used arguments only)
+		const VkRenderPass RP,
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr);
+	void CreatePipeline_Compute(VkPipeline& PL, const VkShaderModule SM, const VkPipelineLayout PLL, const VkSpecializationInfo* SI = nullptr);
+	//!< ダイナミックレンダリングの場合は RP に VK_NULL_HANDLE、PRCI にアタッチメントフォーマットを指定する (For dynamic rendering, RP is VK_NULL_HANDLE and PRCI specifies attachment formats)
+	//!< パーツ毎のライブラリを高速リンクして作成し、最適化リンクはバックグラウンドで行う (Fast link per part libraries, optimized link is done in background)
+	void CreatePipeline_Library(VkPipeline& PL,
+		const std::vector<VkPipelineShaderStageCreateInfo>& PSSCIs,
+		const VkPipelineVertexInputStateCreateInfo& PVISCI,
+		const VkPipelineInputAssemblyStateCreateInfo& PIASCI,
+		const VkPipelineTessellationStateCreateInfo& PTSCI,
+		const VkPipelineViewportStateCreateInfo& PVSCI,
+		const VkPipelineRasterizationStateCreateInfo& PRSCI,
+		const VkPipelineMultisampleStateCreateInfo& PMSCI,
+		const VkPipelineDepthStencilStateCreateInfo& PDSSCI,
+		const VkPipelineColorBlendStateCreateInfo& PCBSCI,
+		const VkPipelineDynamicStateCreateInfo& PDSCI,
+		const VkPipelineLayout PLL,
+		const VkRenderPass RP,
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr);
+	//!< シェーダステージ毎のスペシャライゼーション情報 (VS, FS, TES, TCS, GS の順) (Specialization info per shader stage, in VS, FS, TES, TCS, GS order)
+	using SpecializationInfos = std::array<const VkSpecializationInfo*, 5>;
+	//!< constant_id 0 から順に同じ型の定数を並べたもの (Constants of same type, laid out in order from constant_id 0)
+	template<typename T, size_t N>
+	struct Specialization
+	{
+		Specialization(const std::array<T, N>& Values) : Data(Values) {
+			for (uint32_t i = 0; i < N; ++i) {
+				SMEs[i] = VkSpecializationMapEntry({ .constantID = i, .offset = static_cast<uint32_t>(sizeof(T) * i), .size = sizeof(T) });
+			}
+		}
+		Specialization(const Specialization&) = delete;
+		const VkSpecializationInfo* Get() {
+			SI = VkSpecializationInfo({ .mapEntryCount = static_cast<uint32_t>(N), .pMapEntries = std::data(SMEs), .dataSize = sizeof(Data), .pData = std::data(Data) });
+			return &SI;
+		}
+		std::array<T, N> Data;
+		std::array<VkSpecializationMapEntry, N> SMEs;
+		VkSpecializationInfo SI;
+	};
+	//!< 引数をよく使うものに絞ったもの (Frequently used arguments only)
 	void CreatePipeline(VkPipeline& PL,
 		const VkShaderModule VS, const VkShaderModule FS, const VkShaderModule TES, const VkShaderModule TCS, const VkShaderModule GS,
 		const std::vector<VkVertexInputBindingDescription>& VIBDs, const std::vector<VkVertexInputAttributeDescription>& VIADs,
@@ -449,14 +696,18 @@ public:
 		const VkPolygonMode PM, const VkCullModeFlags CMF, const VkFrontFace FF,
 		const VkBool32 DepthEnable,
 		const VkPipelineLayout PLL,
-		const VkRenderPass RP);
-	//!< _f[^ɂʏ탁bV`擙 (Draw mesh with vertices)
+		const VkRenderPass RP,
+		const SpecializationInfos& SIs = {},
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr);
+	//!< 頂点データによる通常メッシュ描画等 (Draw mesh with vertices)
 	void CreatePipeline(VkPipeline& PL,
 		const VkShaderModule VS, const VkShaderModule FS,
 		const std::vector<VkVertexInputBindingDescription>& VIBDs, const std::vector<VkVertexInputAttributeDescription>& VIADs,
 		const VkBool32 DepthEnable,
 		const VkPipelineLayout PLL,
-		const VkRenderPass RP) {
+		const VkRenderPass RP,
+		const SpecializationInfos& SIs = {},
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr) {
 		CreatePipeline(PL,
 			VS, FS, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE,
 			VIBDs, VIADs,
@@ -465,13 +716,17 @@ public:
 			VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, VK_FRONT_FACE_COUNTER_CLOCKWISE,
 			DepthEnable,
 			PLL,
-			RP);
+			RP,
+			SIs,
+			PRCI);
 	}
-	//!< Sʃ|S`擙 (Fullscreen polygon draw)
+	//!< 全画面ポリゴン描画等 (Fullscreen polygon draw)
 	void CreatePipeline(VkPipeline& PL,
 		const VkShaderModule VS, const VkShaderModule FS,
 		const VkPipelineLayout PLL,
-		const VkRenderPass RP) {
+		const VkRenderPass RP,
+		const SpecializationInfos& SIs = {},
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr) {
 		CreatePipeline(PL,
 			VS, FS, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE,
 			{}, {},
@@ -480,13 +735,17 @@ public:
 			VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, VK_FRONT_FACE_COUNTER_CLOCKWISE,
 			VK_FALSE,
 			PLL,
-			RP);
+			RP,
+			SIs,
+			PRCI);
 	}
-	//!< ebZ[Vɂ`擙 (Tesselation draw)
+	//!< テッセレーションによる描画等 (Tesselation draw)
 	void CreatePipeline(VkPipeline& PL,
 		const VkShaderModule VS, const VkShaderModule FS, const VkShaderModule TES, const VkShaderModule TCS, const VkShaderModule GS,
 		const VkPipelineLayout PLL,
-		const VkRenderPass RP) {
+		const VkRenderPass RP,
+		const SpecializationInfos& SIs = {},
+		const VkPipelineRenderingCreateInfo* PRCI = nullptr) {
 		CreatePipeline(PL,
 			VS, FS, TES, TCS, GS,
 			{}, {},
@@ -495,8 +754,22 @@ public:
 			VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, VK_FRONT_FACE_COUNTER_CLOCKWISE,
 			VK_TRUE,
 			PLL,
-			RP);
+			RP,
+			SIs,
+			PRCI);
 	}
+	//!< 拡張ダイナミックステート、USE_EXTENDED_DYNAMIC_STATE 定義時はパイプライン作成時の値の代わりにこちらが使われる
+	//!< (Extended dynamic state, used instead of pipeline creation values when USE_EXTENDED_DYNAMIC_STATE is defined)
+	struct DynamicState
+	{
+		VkPrimitiveTopology Topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+		VkPolygonMode PolygonMode = VK_POLYGON_MODE_FILL;
+		VkCullModeFlags CullMode = VK_CULL_MODE_BACK_BIT;
+		VkFrontFace FrontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+		VkBool32 DepthEnable = VK_FALSE;
+	};
+	void SetDynamicState(const VkCommandBuffer CB, const DynamicState& DS);
+
 	void CreateFramebuffer(const VkRenderPass RP);
 
 	void CreateSampler(const VkSamplerCreateInfo& SCI) { VERIFY_SUCCEEDED(vkCreateSampler(Device, &SCI, nullptr, &Samplers.emplace_back())); }
@@ -510,7 +783,7 @@ public:
 			.mipLodBias = 0.0f,
 			.anisotropyEnable = VK_FALSE, .maxAnisotropy = 1.0f,
 			.compareEnable = VK_FALSE, .compareOp = VK_COMPARE_OP_NEVER,
-			.minLod = 0.0f, .maxLod = 1.0f,
+			.minLod = 0.0f, .maxLod = VK_LOD_CLAMP_NONE, //!< ミップを全て使う、レベル数以上にはならない (Use all mips, clamped to level count anyway)
 			.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE,
 			.unnormalizedCoordinates = VK_FALSE
 		};
@@ -526,19 +799,20 @@ public:
 		VERIFY_SUCCEEDED(vkCreateDescriptorSetLayout(Device, &DSLCI, nullptr, &DSL));
 		return DSL;
 	}
-	VkDescriptorSetLayout CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& DSLBs) {
+	//!< プッシュデスクリプタにする場合は VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR を指定する (ダイナミックバッファは使用できない) 
+	//!< (Specify VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR for push descriptor (dynamic buffers are not allowed))
+	VkDescriptorSetLayout CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& DSLBs, const VkDescriptorSetLayoutCreateFlags DSLCF = 0) {
 		const VkDescriptorSetLayoutCreateInfo DSLCI = {
 			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
 			.pNext = nullptr,
-			.flags = 0,
+			.flags = DSLCF,
 			.bindingCount = static_cast<uint32_t>(std::size(DSLBs)), .pBindings = std::data(DSLBs)
 		};
 		return CreateDescriptorSetLayout(DSLCI);
 	}
 
 	void CreatePipelineLayout(const VkPipelineLayoutCreateInfo& PLCI) { VERIFY_SUCCEEDED(vkCreatePipelineLayout(Device, &PLCI, nullptr, &PipelineLayouts.emplace_back())); }
-	void CreatePipelineLayout(const std::vector<VkDescriptorSetLayout>& DSLs) {
-		constexpr std::array<VkPushConstantRange, 0> PCRs;
+	void CreatePipelineLayout(const std::vector<VkDescriptorSetLayout>& DSLs, const std::vector<VkPushConstantRange>& PCRs = {}) {
 		const VkPipelineLayoutCreateInfo PLCI = {
 			.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
 			.pNext = nullptr,
@@ -593,6 +867,30 @@ public:
 		};
 		return CreateDescriptorUpdateTemplate(DUT, DUTCI);
 	}
+	//!< 更新テンプレートはレイアウトとエントリの組毎にキャッシュし、破棄はデストラクタで行う (Update template is cached per layout and entries, destroyed in destructor)
+	VkDescriptorUpdateTemplate GetDescriptorUpdateTemplate(const VkDescriptorSetLayout DSL, const std::vector<VkDescriptorUpdateTemplateEntry>& DUTEs) {
+		const auto Key = HashBytes(HashCombine(HashSeed, DSL), std::as_bytes(std::span(DUTEs)));
+		std::lock_guard Lock(DescriptorUpdateTemplateMutex);
+		if (const auto It = DescriptorUpdateTemplates.find(Key); std::end(DescriptorUpdateTemplates) != It) {
+			return It->second;
+		}
+		VkDescriptorUpdateTemplate DUT;
+		return DescriptorUpdateTemplates[Key] = CreateDescriptorUpdateTemplate(DUT, DUTEs, DSL);
+	}
+
+	//!< バインドレス (Bindless)
+	//!< 更新後バインド (UPDATE_AFTER_BIND) 可能な大きな配列を持つグローバルなデスクリプタセットを 1 つだけ作成し、シェーダはハンドル (配列インデックス) でリソースを参照する
+	//!< (Single global descriptor set with large update-after-bind arrays, shaders access resources via handle (array index))
+	//!< [0] STORAGE_BUFFER[], [1] COMBINED_IMAGE_SAMPLER[] (可変長は最後のバインディングのみ可能) (Only last binding can be variable count)
+	using BindlessHandle = uint32_t;
+	//!< 容量を超えて登録した場合に返る、無効なハンドル (Invalid handle, returned when registering beyond capacity)
+	static constexpr BindlessHandle InvalidBindlessHandle = (std::numeric_limits<BindlessHandle>::max)();
+	void CreateBindlessDescriptor(const uint32_t BufferCapacity = 1024, const uint32_t ImageCapacity = 1024);
+	BindlessHandle RegisterBindlessBuffer(const VkBuffer Buffer, const VkDeviceSize Offset = 0, const VkDeviceSize Range = VK_WHOLE_SIZE);
+	BindlessHandle RegisterBindlessImage(const VkImageView IV, const VkSampler Sampler, const VkImageLayout IL = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	//!< 既存ハンドルのリソースを差し替える (Replace resource of existing handle)
+	void UpdateBindlessBuffer(const BindlessHandle Handle, const VkBuffer Buffer, const VkDeviceSize Offset = 0, const VkDeviceSize Range = VK_WHOLE_SIZE);
+	void UpdateBindlessImage(const BindlessHandle Handle, const VkImageView IV, const VkSampler Sampler, const VkImageLayout IL = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
 	virtual void PopulateSecondaryCommandBuffer(const int i);
 	virtual void PopulatePrimaryCommandBuffer(const int i);
@@ -600,6 +898,27 @@ public:
 	virtual void SubmitAndWait(const VkCommandBuffer CB);
 
 protected:
+	//!< 初期化ステージを計測しながら実行する (Run initialization stage while measuring)
+	void RunInitStage(const char* Name, const std::function<void()>& Func) {
+		const auto Begin = std::chrono::steady_clock::now();
+		Func();
+		const auto End = std::chrono::steady_clock::now();
+		std::lock_guard Lock(InitStageMutex);
+		InitStages.emplace_back(InitStage({ .Name = Name, .Begin = Begin, .End = End, .ThreadID = std::this_thread::get_id() }));
+	}
+	JobSystem::JobHandle ScheduleInitStage(const char* Name, std::function<void()>&& Func, std::initializer_list<JobSystem::JobHandle> Dependencies = {}) {
+		return JobSystem::Get().Schedule([this, Name, Func = std::move(Func)] { RunInitStage(Name, Func); }, Dependencies);
+	}
+	//!< ステージ毎の開始、終了時刻 (Init() 開始からの経過) と実行スレッドを出力する (Output begin, end time (elapsed from Init() start) and thread per stage)
+	void LogInitStages();
+
+	//!< 記録したアップロードコマンドをサブミットし、完了時にシグナルされるタイムライン値と共に差し替え待ちに積む
+	//!< (Submit recorded upload commands, queue for swap with timeline value signaled on completion)
+	void SubmitTextureUpload(const size_t Index, Texture&& Tex, std::function<void(const VkCommandBuffer)>&& Populate);
+	bool SwapUploadedTextures();
+	//!< テクスチャが差し替えられた後に呼ばれる、デスクリプタを更新する (Called after textures are replaced, update descriptors)
+	virtual void UpdateTextureDescriptor() {}
+
 	VkInstance Instance = VK_NULL_HANDLE;
 #ifdef _DEBUG
 	VkDebugUtilsMessengerEXT DebugUtilsMessenger = VK_NULL_HANDLE;
@@ -609,19 +928,63 @@ protected:
 	
 	PhysicalDeviceAndProps SelectedPhysDevice;
 
+	//!< 初期化ステージの計測結果 (Measured initialization stages)
+	struct InitStage
+	{
+		const char* Name;
+		std::chrono::steady_clock::time_point Begin;
+		std::chrono::steady_clock::time_point End;
+		std::thread::id ThreadID;
+	};
+	std::chrono::steady_clock::time_point InitBegin;
+	std::vector<InitStage> InitStages;
+	std::mutex InitStageMutex;
+
 	VkSurfaceKHR Surface = VK_NULL_HANDLE;
 	VkSurfaceFormatKHR SelectedSurfaceFormat;
 	
 	VkDevice Device = VK_NULL_HANDLE;
 
+	VkPipelineCache PipelineCache = VK_NULL_HANDLE;
+	bool IsShutdown = false;
+	//!< キャッシュファイルの先頭に付ける独自ヘッダ (Own header prepended to cache file)
+	struct PipelineCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t VendorID;
+		uint32_t DeviceID;
+		uint32_t DriverVersion;
+		uint8_t PipelineCacheUUID[VK_UUID_SIZE];
+		uint64_t DataSize;
+	};
+	static constexpr uint32_t PipelineCacheMagic = 0x43504b56; //!< 'VKPC'
+	struct TextureCacheHeader
+	{
+		uint32_t Magic;
+		int32_t Type; //!< cv::Mat::type()
+		uint64_t Key;
+		uint32_t Rows;
+		uint32_t Cols;
+	};
+	static constexpr uint32_t TextureCacheMagic = 0x43544b56; //!< 'VKTC'
+
 	QueueAndFamilyIndex GraphicsQueue = QueueAndFamilyIndex({ VK_NULL_HANDLE, (std::numeric_limits<uint32_t>::max)() });
 	QueueAndFamilyIndex PresentQueue = QueueAndFamilyIndex({ VK_NULL_HANDLE, (std::numeric_limits<uint32_t>::max)() });
 
+	//!< フェンスは 1 つで、毎フレーム Render() の先頭で待つので、同時に処理中 (in flight) のフレームは 1 つ
+	//!< (Single fence, waited at beginning of Render() every frame, so one frame is in flight)
+	static constexpr uint32_t FramesInFlight = 1;
 	VkFence Fence = VK_NULL_HANDLE;
 
 	VkSemaphore NextImageAcquiredSemaphore = VK_NULL_HANDLE;
 	VkSemaphore RenderFinishedSemaphore = VK_NULL_HANDLE;
 
+	//!< キューへのアクセスは外部同期が必要、ワーカースレッドからのアップロードと排他する (Queue access must be externally synchronized, exclusive with upload from worker threads)
+	std::mutex QueueMutex;
+	//!< 非同期アップロードの完了でシグナルされるタイムラインセマフォ (Timeline semaphore signaled on async upload completion)
+	VkSemaphore UploadSemaphore = VK_NULL_HANDLE;
+	uint64_t UploadSemaphoreValue = 0;
+
 	struct Swapchain
 	{
 		VkSwapchainKHR VkSwapchain = VK_NULL_HANDLE;
@@ -632,15 +995,34 @@ protected:
 	Swapchain Swapchain;
 
 	std::vector<CommandPoolAndBuffers> PrimaryCommandBuffers;
-	std::vector<CommandPoolAndBuffers> SecondaryCommandBuffers; //!< VK ł̓v[ZJ_pɕKv͖ADX ɍ킹ĕʂɂĂ
+	std::vector<CommandPoolAndBuffers> SecondaryCommandBuffers; //!< VK ではプールをセカンダリ用に分ける必要は無いが、DX に合わせて別にしている
+	std::vector<CommandPoolAndBuffers> TransferCommandBuffers;
 
 	std::vector<BufferAndDeviceMemory> VertexBuffers;
 	std::vector<BufferAndDeviceMemory> IndexBuffers;
 	std::vector<BufferAndDeviceMemory> IndirectBuffers;
 
 	std::vector<BufferAndDeviceMemory> UniformBuffers;
+	std::vector<BufferAndDeviceMemory> StorageBuffers;
 
 	std::vector<Texture> Textures;
+	//!< キャッシュキーから Textures のインデックス (Cache key to index of Textures)
+	std::map<size_t, size_t> TextureKeys;
+	//!< 非同期で読み込み中のインデックス、共有元がこれに含まれる場合は差し替え後に共有する (Indices being loaded asynchronously, if share source is included, share after replacement)
+	std::set<size_t> UploadingTextureIndices;
+	//!< 共有元のアップロード完了待ちの共有 (Src, Dst) (Shares (Src, Dst) waiting for upload of source)
+	std::vector<std::pair<size_t, size_t>> PendingTextureShares;
+	//!< アップロード中のテクスチャ、タイムライン値に達したら Textures[Index] と差し替える (Uploading textures, replace Textures[Index] when timeline value is reached)
+	struct TextureUpload
+	{
+		size_t Index;
+		Texture Tex;
+		VkCommandPool CommandPool;
+		uint64_t TimelineValue;
+	};
+	std::vector<JobSystem::JobHandle> TextureUploadJobs;
+	std::vector<TextureUpload> TextureUploads;
+	std::mutex TextureUploadMutex;
 
 	std::vector<VkSampler> Samplers;
 	std::vector<VkDescriptorSetLayout> DescriptorSetLayouts;
@@ -655,6 +1037,69 @@ protected:
 	std::vector<VkDescriptorPool> DescriptorPools;
 	std::vector<VkDescriptorSet> DescriptorSets;
 
+	//!< 足りなくなったらプールを追加するアロケータ (Allocator adding pool on demand)
+	DescriptorAllocator DescriptorSetAllocator;
+	//!< レイアウトとエントリのハッシュ → 更新テンプレート (Hash of layout and entries -> update template)
+	std::map<size_t, VkDescriptorUpdateTemplate> DescriptorUpdateTemplates;
+	std::mutex DescriptorUpdateTemplateMutex;
+
+	//!< 頂点パイプライン (頂点、テッセレーション、ジオメトリ)、フラグメントシェーダからのストレージへの書き込み、アトミック
+	//!< (Storage writes, atomics from vertex pipeline (vertex, tessellation, geometry), fragment shader)
+	bool HasShaderStores = false;
+
+	//!< プッシュデスクリプタ、セットを確保せずにコマンドバッファへ直接書き込む (Push descriptor, write descriptors directly into command buffer without allocating set)
+	bool HasPushDescriptor = false;
+	PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSet = nullptr;
+
+	//!< ポリゴンモードのダイナミックステート (VK_EXT_extended_dynamic_state3) (Polygon mode dynamic state)
+	bool HasDynamicPolygonMode = false;
+	PFN_vkCmdSetPolygonModeEXT vkCmdSetPolygonMode = nullptr;
+
+	//!< グラフィックスパイプラインライブラリ (Graphics pipeline library)
+	bool HasGraphicsPipelineLibrary = false;
+	//!< ライブラリと、キーにハンドルとして含まれるレイアウト、レンダーパス (Library, and layout, render pass included in key as handles)
+	struct PipelineLibrary
+	{
+		VkPipeline Pipeline;
+		VkPipelineLayout Layout;
+		VkRenderPass RenderPass;
+	};
+	//!< パーツの内容のハッシュ → ライブラリ (Hash of part contents -> library)
+	std::map<size_t, PipelineLibrary> PipelineLibraries;
+	std::mutex PipelineLibraryMutex;
+	//!< シェーダモジュール → SPIR-V のハッシュ (ハンドルは再利用されるので内容で識別する) (Shader module -> SPIR-V hash (handles are reused, so identify by contents))
+	std::map<VkShaderModule, size_t> ShaderModuleHashes;
+	std::mutex ShaderModuleHashMutex;
+	//!< 高速リンクしたパイプライン → 最適化リンクしたパイプライン (Fast linked pipeline -> optimized linked pipeline)
+	std::map<VkPipeline, VkPipeline> OptimizedPipelines;
+	std::vector<JobSystem::JobHandle> PipelineLinkJobs;
+	//!< 最適化リンク中、リンク完了時に破棄する (Optimized linking, destroyed when link completes)
+	std::set<VkPipeline> LinkingPipelines;
+	std::set<VkPipeline> RetiredPipelines;
+	std::mutex OptimizedPipelineMutex;
+
+	//!< 作り直したパイプライン (Recreated pipelines)
+	JobSystem::JobHandle PipelineRecreateJob;
+	std::vector<VkPipeline> RecreatedPipelines;
+	std::mutex RecreatedPipelineMutex;
+#ifdef USE_SHADER_HOT_RELOAD
+	std::unique_ptr<ShaderWatcher> ShaderWatch;
+#endif
+
+	//!< デスクリプタインデクシング (更新後バインド、部分バインド、可変長配列) をサポートするか (Descriptor indexing (update after bind, partially bound, variable count) is supported)
+	bool HasBindless = false;
+	struct BindlessDescriptor
+	{
+		VkDescriptorSetLayout DescriptorSetLayout = VK_NULL_HANDLE;
+		VkDescriptorPool DescriptorPool = VK_NULL_HANDLE;
+		VkDescriptorSet DescriptorSet = VK_NULL_HANDLE;
+		uint32_t BufferCapacity = 0;
+		uint32_t ImageCapacity = 0;
+		uint32_t BufferCount = 0;
+		uint32_t ImageCount = 0;
+	};
+	BindlessDescriptor Bindless;
+
 	std::vector<VkViewport> Viewports;
 	std::vector<VkRect2D> ScissorRects;
 
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstring>
+#include <algorithm>
+
+#include "TextureFile.h"
+
+//!< 仮想テクスチャ、ミップ付きの DDS, KTX をページに分割し、フィードバックで要求されたページのみを物理ページアトラスのスロットへ常駐させる
+//!< (Virtual texture, split DDS, KTX with mips into pages, only pages requested via feedback are made resident in slots of physical page atlas)
+//!< ページテーブルはページ毎に (スロット X, スロット Y, 常駐レベル) を持ち、常駐していないページは親ページのエントリを引き継ぐ
+//!< (Page table holds (slot X, slot Y, resident level) per page, non resident page inherits entry of parent page)
+//!< 非圧縮の 2D のみ扱う、最も粗いレベルが 1 ページに収まるだけのミップが必要 (Uncompressed 2D only, needs mips until coarsest level fits in a page)
+class VirtualTexture
+{
+public:
+	//!< スロットはページの周囲にバイリニアフィルタ用のボーダーを持つ (Slot has border around page for bilinear filter)
+	static constexpr uint32_t PageSize = 128;
+	static constexpr uint32_t Border = 1;
+	static constexpr uint32_t SlotSize = PageSize + Border * 2;
+	static constexpr uint32_t InvalidIndex = 0xffffffff;
+
+	struct Upload
+	{
+		uint32_t Page;
+		uint32_t Slot;
+	};
+
+	VirtualTexture(const std::filesystem::path& Path, const uint32_t SlotsX, const uint32_t SlotsY) : File(Path), SlotCountX(SlotsX), SlotCountY(SlotsY) {
+		if (!File.IsValid() || gli::TARGET_2D != File.GetTarget() || gli::is_compressed(File.GetFormat())) { return; }
+		//!< スロット座標はページテーブルに 8 ビットずつで格納する (Slot coordinates are stored in 8 bits each in page table)
+		if (SlotsX > 256 || SlotsY > 256) { return; }
+
+		TexelSize = static_cast<uint32_t>(gli::block_size(File.GetFormat()));
+		//!< 2D なのでレイヤは 1 つ、領域はレベル順に並ぶ (2D, so single layer, regions are in level order)
+		for (const auto& i : File.GetRegions()) {
+			const auto& Lv = Levels.emplace_back(Level({
+				.Width = static_cast<uint32_t>(i.Extent.x), .Height = static_cast<uint32_t>(i.Extent.y),
+				.PagesX = (static_cast<uint32_t>(i.Extent.x) + PageSize - 1) / PageSize, .PagesY = (static_cast<uint32_t>(i.Extent.y) + PageSize - 1) / PageSize,
+				.PageOffset = PageCount,
+				.DataOffset = i.Offset
+			}));
+			for (uint32_t y = 0; y < Lv.PagesY; ++y) {
+				for (uint32_t x = 0; x < Lv.PagesX; ++x) {
+					Pages.emplace_back(Page({ .Level = static_cast<uint32_t>(std::size(Levels)) - 1, .X = x, .Y = y }));
+				}
+			}
+			PageCount += Lv.PagesX * Lv.PagesY;
+			if (1 == Lv.PagesX * Lv.PagesY) { break; }
+		}
+		if (std::empty(Levels) || 1 != Levels.back().PagesX * Levels.back().PagesY) {
+			Levels.clear();
+			Pages.clear();
+			return;
+		}
+
+		Slots.assign(static_cast<size_t>(SlotsX) * SlotsY, InvalidIndex);
+		PageTable.assign(PageCount, 0);
+
+		//!< 最も粗いレベルのページは常駐させたままにし、全てのページのフォールバックにする (Keep page of coarsest level resident, as fallback for all pages)
+		Pages.back().IsPinned = true;
+		Requests.emplace_back(PageCount - 1);
+	}
+	VirtualTexture(const VirtualTexture&) = delete;
+	VirtualTexture& operator=(const VirtualTexture&) = delete;
+
+	bool IsValid() const { return !std::empty(Levels); }
+
+	gli::format GetFormat() const { return File.GetFormat(); }
+	uint32_t GetWidth() const { return Levels.front().Width; }
+	uint32_t GetHeight() const { return Levels.front().Height; }
+	uint32_t GetMaxLevel() const { return static_cast<uint32_t>(std::size(Levels)) - 1; }
+	uint32_t GetPageCount() const { return PageCount; }
+	uint32_t GetSlotCountX() const { return SlotCountX; }
+	uint32_t GetSlotCountY() const { return SlotCountY; }
+	//!< スロット 1 つ分のサイズ (ステージング上の 1 ページ分) (Size of a slot (a page on staging))
+	size_t GetSlotBytes() const { return static_cast<size_t>(SlotSize) * SlotSize * TexelSize; }
+	VkOffset3D GetSlotOffset(const uint32_t Slot) const { return VkOffset3D({ .x = static_cast<int32_t>((Slot % SlotCountX) * SlotSize), .y = static_cast<int32_t>((Slot / SlotCountX) * SlotSize), .z = 0 }); }
+
+	std::span<const uint32_t> GetPageTable() const { return PageTable; }
+	//!< 前回の呼び出し以降にページテーブルが更新されていれば true (True if page table has been updated since last call)
+	bool ConsumeDirty() { return std::exchange(IsDirty, false); }
+
+	//!< フィードバック (ページ毎に 0 以外なら要求) から要求を集める、常駐していない祖先ページも要求する
+	//!< (Collect requests from feedback (non zero per page means requested), non resident ancestor pages are also requested)
+	void Request(std::span<const uint32_t> Feedback, const uint32_t Frame) {
+		const auto Count = (std::min)(static_cast<uint32_t>(std::size(Feedback)), PageCount);
+		for (uint32_t i = 0; i < Count; ++i) {
+			if (0 == Feedback[i]) { continue; }
+			for (auto j = i; InvalidIndex != j; j = GetParent(j)) {
+				auto& P = Pages[j];
+				//!< 祖先は既に辿り済み (Ancestors already visited)
+				if (j != i && Frame == P.LastUsed) { break; }
+				P.LastUsed = Frame;
+				if (InvalidIndex == P.Slot) { Requests.emplace_back(j); }
+			}
+		}
+	}
+
+	//!< 要求されたページを粗いレベルから最大 MaxCount 個スロットへ割り当てる、空きが無ければこのフレームで使われていないページを LRU で追い出す
+	//!< (Assign up to MaxCount requested pages to slots from coarse levels, if no free slot, evict page not used in this frame by LRU)
+	//!< 返したページは CopyPage() でステージングへコピーし、アトラスの GetSlotOffset() へ転送すること (Copy returned pages to staging with CopyPage(), and transfer to GetSlotOffset() of atlas)
+	std::vector<Upload> Update(const uint32_t MaxCount, const uint32_t Frame) {
+		std::ranges::sort(Requests, [&](const uint32_t lhs, const uint32_t rhs) { return Pages[lhs].Level != Pages[rhs].Level ? Pages[lhs].Level > Pages[rhs].Level : lhs < rhs; });
+		const auto [First, Last] = std::ranges::unique(Requests);
+		Requests.erase(First, Last);
+
+		std::vector<Upload> Uploads;
+		for (const auto i : Requests) {
+			if (std::size(Uploads) >= MaxCount) { break; }
+			auto& P = Pages[i];
+			if (InvalidIndex != P.Slot) { continue; }
+			const auto Slot = AllocateSlot(Frame);
+			if (InvalidIndex == Slot) { break; }
+			if (InvalidIndex != Slots[Slot]) {
+				Pages[Slots[Slot]].Slot = InvalidIndex;
+			}
+			Slots[Slot] = i;
+			P.Slot = Slot;
+			P.LastUsed = Frame;
+			Uploads.emplace_back(Upload({ .Page = i, .Slot = Slot }));
+		}
+		//!< 溢れた要求は次のフレームのフィードバックで再度要求される (Overflowed requests are requested again by feedback of next frame)
+		Requests.clear();
+
+		if (!std::empty(Uploads)) {
+			UpdatePageTable();
+		}
+		return Uploads;
+	}
+
+	//!< ページをボーダー付きでコピーする、レベルの外側は端のテクセルで埋める (Copy page with border, outside of level is filled with edge texel)
+	void CopyPage(const uint32_t Index, std::byte* Dst) const {
+		const auto& P = Pages[Index];
+		const auto& Lv = Levels[P.Level];
+		const auto Src = std::data(File.GetData()) + Lv.DataOffset;
+		const auto W = static_cast<int>(Lv.Width), H = static_cast<int>(Lv.Height);
+		const auto X0 = static_cast<int>(P.X * PageSize) - static_cast<int>(Border);
+		const auto Y0 = static_cast<int>(P.Y * PageSize) - static_cast<int>(Border);
+		//!< レベル内の範囲は行毎に 1 回でコピーする (Range inside level is copied once per row)
+		const auto Begin = std::clamp(X0, 0, W), End = std::clamp(X0 + static_cast<int>(SlotSize), 0, W);
+		for (uint32_t y = 0; y < SlotSize; ++y) {
+			const auto SrcRow = Src + static_cast<size_t>(std::clamp(Y0 + static_cast<int>(y), 0, H - 1)) * W * TexelSize;
+			const auto DstRow = Dst + static_cast<size_t>(y) * SlotSize * TexelSize;
+			for (auto x = X0; x < Begin; ++x) {
+				std::memcpy(DstRow + static_cast<size_t>(x - X0) * TexelSize, SrcRow + static_cast<size_t>(Begin) * TexelSize, TexelSize);
+			}
+			std::memcpy(DstRow + static_cast<size_t>(Begin - X0) * TexelSize, SrcRow + static_cast<size_t>(Begin) * TexelSize, static_cast<size_t>(End - Begin) * TexelSize);
+			for (auto x = End; x < X0 + static_cast<int>(SlotSize); ++x) {
+				std::memcpy(DstRow + static_cast<size_t>(x - X0) * TexelSize, SrcRow + static_cast<size_t>(End - 1) * TexelSize, TexelSize);
+			}
+		}
+	}
+
+protected:
+	struct Level
+	{
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t PagesX;
+		uint32_t PagesY;
+		uint32_t PageOffset;
+		size_t DataOffset;
+	};
+	struct Page
+	{
+		uint32_t Level;
+		uint32_t X;
+		uint32_t Y;
+		uint32_t Slot = InvalidIndex;
+		uint32_t LastUsed = InvalidIndex;
+		bool IsPinned = false;
+	};
+
+	uint32_t GetParent(const uint32_t Index) const {
+		const auto& P = Pages[Index];
+		if (P.Level >= GetMaxLevel()) { return InvalidIndex; }
+		const auto& Lv = Levels[P.Level + 1];
+		return Lv.PageOffset + (std::min)(P.Y >> 1, Lv.PagesY - 1) * Lv.PagesX + (std::min)(P.X >> 1, Lv.PagesX - 1);
+	}
+	uint32_t AllocateSlot(const uint32_t Frame) const {
+		auto Victim = InvalidIndex;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(std::size(Slots)); ++i) {
+			if (InvalidIndex == Slots[i]) { return i; }
+			const auto& P = Pages[Slots[i]];
+			if (P.IsPinned || Frame == P.LastUsed) { continue; }
+			if (InvalidIndex == Victim || P.LastUsed < Pages[Slots[Victim]].LastUsed) { Victim = i; }
+		}
+		return Victim;
+	}
+	//!< 粗いレベルから順に埋める、常駐していなければ親のエントリを引き継ぐ (Fill from coarse level, inherit entry of parent if not resident)
+	void UpdatePageTable() {
+		for (auto i = static_cast<uint32_t>(std::size(Levels)); i-- > 0;) {
+			const auto& Lv = Levels[i];
+			for (auto j = Lv.PageOffset; j < Lv.PageOffset + Lv.PagesX * Lv.PagesY; ++j) {
+				const auto& P = Pages[j];
+				if (InvalidIndex != P.Slot) {
+					PageTable[j] = (P.Slot % SlotCountX) | ((P.Slot / SlotCountX) << 8) | (i << 16);
+				}
+				else {
+					const auto Parent = GetParent(j);
+					PageTable[j] = InvalidIndex != Parent ? PageTable[Parent] : 0;
+				}
+			}
+		}
+		IsDirty = true;
+	}
+
+	TextureFile File;
+	uint32_t TexelSize = 0;
+	uint32_t SlotCountX;
+	uint32_t SlotCountY;
+	std::vector<Level> Levels;
+	std::vector<Page> Pages;
+	uint32_t PageCount = 0;
+	//!< スロットに割り当てられたページ (Page assigned to slot)
+	std::vector<uint32_t> Slots;
+	std::vector<uint32_t> Requests;
+	std::vector<uint32_t> PageTable;
+	bool IsDirty = false;
+};